@@ -0,0 +1,192 @@
+///
+/// @file
+/// @copyright Copyright (c) 2023. MIT License.
+///
+#include "perception/common/async_log_backend.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+
+namespace perception
+{
+namespace
+{
+static_assert((AsyncLogBackend::kCapacity & (AsyncLogBackend::kCapacity - 1U)) == 0U,
+              "Capacity must be power of two.");
+
+/// @brief Index mask for the ring buffer
+constexpr std::size_t kIndexMask{AsyncLogBackend::kCapacity - 1U};
+}  // namespace
+
+constexpr std::size_t AsyncLogBackend::kCapacity;
+constexpr std::size_t AsyncLogBackend::kMaxMessageLength;
+constexpr std::chrono::milliseconds AsyncLogBackend::kWriterIdlePeriod;
+
+AsyncLogBackend& AsyncLogBackend::GetInstance()
+{
+    // Intentionally never destroyed, so that logging from static destructors remains valid (writes synchronously
+    // once backend is shutdown at exit).
+    static AsyncLogBackend* const instance = [] {
+        auto* backend = new AsyncLogBackend{};
+        std::atexit([] { GetInstance().Shutdown(); });
+        return backend;
+    }();
+    return *instance;
+}
+
+AsyncLogBackend::AsyncLogBackend()
+    : records_{},
+      enqueue_position_{0U},
+      dequeue_position_{0U},
+      number_of_dropped_messages_{0},
+      number_of_reported_dropped_messages_{0},
+      drain_mutex_{},
+      running_{true},
+      writer_{}
+{
+    for (std::size_t index = 0U; index < kCapacity; ++index)
+    {
+        records_[index].sequence.store(index, std::memory_order_relaxed);
+    }
+    writer_ = std::thread{&AsyncLogBackend::Run, this};
+}
+
+AsyncLogBackend::~AsyncLogBackend()
+{
+    Shutdown();
+}
+
+bool AsyncLogBackend::Log(const LoggingWrapper::LogSeverity severity, const std::string& message)
+{
+    if (!running_.load(std::memory_order_acquire))
+    {
+        Write(severity, message.data(), message.size());
+        std::flush((severity == LoggingWrapper::LogSeverity::ERROR) ? std::cerr : std::cout);
+        return true;
+    }
+
+    auto position = enqueue_position_.load(std::memory_order_relaxed);
+    Record* record{nullptr};
+    while (true)
+    {
+        record = &records_[position & kIndexMask];
+        const auto sequence = record->sequence.load(std::memory_order_acquire);
+        const auto difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position);
+        if (difference == 0)
+        {
+            if (enqueue_position_.compare_exchange_weak(position, position + 1U, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (difference < 0)
+        {
+            number_of_dropped_messages_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        else
+        {
+            position = enqueue_position_.load(std::memory_order_relaxed);
+        }
+    }
+
+    record->severity = severity;
+    record->length = std::min(message.size(), kMaxMessageLength);
+    std::copy_n(message.data(), record->length, record->message.begin());
+    record->sequence.store(position + 1U, std::memory_order_release);
+    return true;
+}
+
+void AsyncLogBackend::Flush()
+{
+    std::lock_guard<std::mutex> lock{drain_mutex_};
+    Drain();
+}
+
+void AsyncLogBackend::Fatal(const std::string& message)
+{
+    // Do not block on writer thread (i.e. lock might be held by a thread which no longer exists in forked process)
+    if (drain_mutex_.try_lock())
+    {
+        Drain();
+        drain_mutex_.unlock();
+    }
+    Write(LoggingWrapper::LogSeverity::ERROR, message.data(), message.size());
+    std::flush(std::cerr);
+    std::abort();
+}
+
+void AsyncLogBackend::Shutdown()
+{
+    if (running_.exchange(false))
+    {
+        writer_.join();
+    }
+    Flush();
+}
+
+std::int64_t AsyncLogBackend::GetNumberOfDroppedMessages() const
+{
+    return number_of_dropped_messages_.load(std::memory_order_relaxed);
+}
+
+void AsyncLogBackend::Run()
+{
+    while (running_.load(std::memory_order_acquire))
+    {
+        bool written{false};
+        {
+            std::lock_guard<std::mutex> lock{drain_mutex_};
+            written = Drain();
+        }
+        if (!written)
+        {
+            std::this_thread::sleep_for(kWriterIdlePeriod);
+        }
+    }
+}
+
+bool AsyncLogBackend::Drain()
+{
+    bool written{false};
+    while (true)
+    {
+        auto& record = records_[dequeue_position_ & kIndexMask];
+        const auto sequence = record.sequence.load(std::memory_order_acquire);
+        if (static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(dequeue_position_ + 1U) < 0)
+        {
+            break;
+        }
+
+        Write(record.severity, record.message.data(), record.length);
+        record.sequence.store(dequeue_position_ + kCapacity, std::memory_order_release);
+        ++dequeue_position_;
+        written = true;
+    }
+
+    const auto number_of_dropped_messages = number_of_dropped_messages_.load(std::memory_order_relaxed);
+    if (number_of_dropped_messages != number_of_reported_dropped_messages_)
+    {
+        std::cerr << "Logging: dropped " << (number_of_dropped_messages - number_of_reported_dropped_messages_)
+                  << " messages (ring buffer full).\n";
+        number_of_reported_dropped_messages_ = number_of_dropped_messages;
+        written = true;
+    }
+
+    if (written)
+    {
+        std::flush(std::cout);
+        std::flush(std::cerr);
+    }
+    return written;
+}
+
+void AsyncLogBackend::Write(const LoggingWrapper::LogSeverity severity, const char* message, const std::size_t length)
+{
+    auto& stream = (severity == LoggingWrapper::LogSeverity::ERROR) ? std::cerr : std::cout;
+    stream.write(message, static_cast<std::streamsize>(length));
+    stream.put('\n');
+}
+
+}  // namespace perception
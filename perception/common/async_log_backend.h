@@ -0,0 +1,126 @@
+///
+/// @file
+/// @copyright Copyright (c) 2023. MIT License.
+///
+#ifndef PERCEPTION_COMMON_ASYNC_LOG_BACKEND_H
+#define PERCEPTION_COMMON_ASYNC_LOG_BACKEND_H
+
+#include "perception/common/logging.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace perception
+{
+
+/// @brief Asynchronous logging backend. Log messages are copied into a preallocated ring buffer (lock-free, multiple
+/// producers) and written to stdout/stderr by a background writer thread, hence no I/O takes place on the logging
+/// thread.
+///
+/// @note Messages longer than kMaxMessageLength are truncated. If ring buffer is full, messages are dropped (and
+/// reported by writer thread) instead of blocking the logging thread.
+class AsyncLogBackend final
+{
+  public:
+    /// @brief Number of messages the ring buffer can hold (power of two)
+    static constexpr std::size_t kCapacity{512U};
+
+    /// @brief Max length of a single message (in bytes)
+    static constexpr std::size_t kMaxMessageLength{512U};
+
+    /// @brief Period for which writer thread sleeps, when there is nothing to write
+    static constexpr std::chrono::milliseconds kWriterIdlePeriod{5};
+
+    /// @brief Provide process-wide instance (started on first use, drained and stopped at exit)
+    static AsyncLogBackend& GetInstance();
+
+    /// @brief Constructor (starts writer thread)
+    AsyncLogBackend();
+
+    /// @brief Destructor (stops writer thread, after writing pending messages)
+    ~AsyncLogBackend();
+
+    /// @brief Enqueue message to be written by writer thread
+    ///
+    /// @param severity [in] - Logging Severity (ERROR is written to stderr, rest to stdout)
+    /// @param message [in] - Message to be logged
+    ///
+    /// @return True if message is enqueued, otherwise False (i.e. ring buffer is full)
+    bool Log(const LoggingWrapper::LogSeverity severity, const std::string& message);
+
+    /// @brief Write all the pending messages (blocks until written)
+    void Flush();
+
+    /// @brief Write pending messages (if possible without blocking) and provided message to stderr and abort program
+    ///
+    /// @param message [in] - Message to be logged
+    [[noreturn]] void Fatal(const std::string& message);
+
+    /// @brief Stop writer thread, after writing all the pending messages. Further messages are written synchronously.
+    void Shutdown();
+
+    /// @brief Provide number of messages dropped so far, due to full ring buffer
+    std::int64_t GetNumberOfDroppedMessages() const;
+
+  private:
+    /// @brief Log record stored in the ring buffer
+    struct Record
+    {
+        /// @brief Sequence number used for lock-free hand-off between producers and writer
+        std::atomic<std::size_t> sequence;
+
+        /// @brief Logging Severity
+        LoggingWrapper::LogSeverity severity;
+
+        /// @brief Length of the message
+        std::size_t length;
+
+        /// @brief Message contents (not null-terminated)
+        std::array<char, kMaxMessageLength> message;
+    };
+
+    /// @brief Writer thread loop
+    void Run();
+
+    /// @brief Write all the pending messages (caller must hold drain_mutex_)
+    ///
+    /// @return True if any message is written, otherwise False
+    bool Drain();
+
+    /// @brief Write message to stdout/stderr (based on severity)
+    static void Write(const LoggingWrapper::LogSeverity severity, const char* message, const std::size_t length);
+
+    /// @brief Preallocated ring buffer
+    std::array<Record, kCapacity> records_;
+
+    /// @brief Position of the next record to be claimed by producers
+    std::atomic<std::size_t> enqueue_position_;
+
+    /// @brief Position of the next record to be written (guarded by drain_mutex_)
+    std::size_t dequeue_position_;
+
+    /// @brief Number of messages dropped due to full ring buffer
+    std::atomic<std::int64_t> number_of_dropped_messages_;
+
+    /// @brief Number of dropped messages already reported by writer thread
+    std::int64_t number_of_reported_dropped_messages_;
+
+    /// @brief Serializes consumers of the ring buffer (writer thread and Flush)
+    std::mutex drain_mutex_;
+
+    /// @brief Writer thread is running
+    std::atomic<bool> running_;
+
+    /// @brief Writer thread
+    std::thread writer_;
+};
+
+}  // namespace perception
+
+#endif  /// PERCEPTION_COMMON_ASYNC_LOG_BACKEND_H
@@ -4,8 +4,12 @@
 ///
 #include "perception/common/logging.h"
 
+#include "perception/common/async_log_backend.h"
+
 namespace perception
 {
+std::atomic<std::int32_t> LoggingWrapper::min_level_{0};
+
 LoggingWrapper::LoggingWrapper(const LogSeverity& severity) : LoggingWrapper{severity, true} {}
 
 LoggingWrapper::LoggingWrapper(const LogSeverity& severity, const bool should_log)
@@ -18,6 +22,16 @@ std::stringstream& LoggingWrapper::Stream()
     return stream_;
 }
 
+void LoggingWrapper::SetMinSeverity(const LogSeverity& severity)
+{
+    min_level_.store(GetLevel(severity), std::memory_order_relaxed);
+}
+
+void LoggingWrapper::Flush()
+{
+    AsyncLogBackend::GetInstance().Flush();
+}
+
 LoggingWrapper::~LoggingWrapper()
 {
     if (should_log_)
@@ -27,15 +41,11 @@ LoggingWrapper::~LoggingWrapper()
             case LogSeverity::DEBUG:
             case LogSeverity::INFO:
             case LogSeverity::WARNING:
-                std::cout << stream_.str() << std::endl;
-                break;
             case LogSeverity::ERROR:
-                std::cerr << stream_.str() << std::endl;
+                AsyncLogBackend::GetInstance().Log(severity_, stream_.str());
                 break;
             case LogSeverity::FATAL:
-                std::cerr << stream_.str() << std::endl;
-                std::flush(std::cerr);
-                std::abort();
+                AsyncLogBackend::GetInstance().Fatal(stream_.str());
                 break;
             default:
                 break;
@@ -5,10 +5,18 @@
 #ifndef PERCEPTION_COMMON_LOGGING_H
 #define PERCEPTION_COMMON_LOGGING_H
 
+#include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <iostream>
 #include <sstream>
 
+/// @brief Compile-time minimum severity level to be logged (0: DEBUG, 1: INFO, 2: WARNING, 3: ERROR, 4: FATAL).
+/// Log statements below this level are compiled out (i.e. stream is never formatted).
+#ifndef PERCEPTION_LOG_MIN_LEVEL
+#define PERCEPTION_LOG_MIN_LEVEL 0
+#endif
+
 namespace perception
 {
 class LoggingWrapper
@@ -33,13 +41,39 @@ class LoggingWrapper
     /// @param [in] should_log - Enable/Disable Logging
     explicit LoggingWrapper(const LogSeverity& severity, const bool should_log);
 
-    /// @brief Destructor
+    /// @brief Destructor (hands over logged contents to asynchronous logging backend)
     ~LoggingWrapper();
 
     /// @brief Provides Stream containing logged contents
     std::stringstream& Stream();
 
+    /// @brief Provide level of the severity, ordered from least (DEBUG) to most (FATAL) severe
+    /// @param [in] severity - Logging Severity
+    static constexpr std::int32_t GetLevel(const LogSeverity severity)
+    {
+        return ((severity == LogSeverity::DEBUG) ? 0 : (static_cast<std::int32_t>(severity) + 1));
+    }
+
+    /// @brief Set runtime minimum severity to be logged (FATAL is always logged)
+    /// @param [in] severity - Minimum Logging Severity
+    static void SetMinSeverity(const LogSeverity& severity);
+
+    /// @brief Check whether provided severity passes compile-time and runtime severity filter
+    /// @param [in] severity - Logging Severity
+    static bool IsEnabled(const LogSeverity severity)
+    {
+        return ((GetLevel(severity) >= PERCEPTION_LOG_MIN_LEVEL) &&
+                (GetLevel(severity) >= min_level_.load(std::memory_order_relaxed))) ||
+               (severity == LogSeverity::FATAL);
+    }
+
+    /// @brief Block until all the pending log messages are written by the logging backend
+    static void Flush();
+
   private:
+    /// @brief Runtime minimum severity level to be logged
+    static std::atomic<std::int32_t> min_level_;
+
     /// @brief Logged String Stream
     std::stringstream stream_;
 
@@ -49,16 +83,98 @@ class LoggingWrapper
     /// @brief Enable/Disable Logging
     bool should_log_;
 };
+
+/// @brief Helper to turn log stream expression into void expression (used by LOG/CHECK macros)
+struct LogMessageVoidify
+{
+    /// @brief Operator with lower precedence than operator<< and higher than ?:
+    void operator&(std::ostream&) {}
+};
+
+/// @brief Check whether every n-th occurrence of a log site is reached (used by LOG_EVERY_N)
+/// @param [in,out] occurrences - Number of occurrences of the log site so far
+/// @param [in] n - Log every n-th occurrence (starting with the first one), never for n = 0 (as LOG_FIRST_N)
+inline bool ShouldLogEveryN(std::atomic<std::uint64_t>& occurrences, const std::uint64_t n)
+{
+    // modulo by zero is undefined
+    return ((n > 0U) && ((occurrences.fetch_add(1U, std::memory_order_relaxed) % n) == 0U));
+}
+
+/// @brief Check whether one of the first n occurrences of a log site is reached (used by LOG_FIRST_N)
+/// @param [in,out] occurrences - Number of occurrences of the log site so far
+/// @param [in] n - Log first n occurrences
+inline bool ShouldLogFirstN(std::atomic<std::uint64_t>& occurrences, const std::uint64_t n)
+{
+    // avoid writing to shared counter, once limit is reached
+    return ((occurrences.load(std::memory_order_relaxed) < n) &&
+            (occurrences.fetch_add(1U, std::memory_order_relaxed) < n));
+}
+
+/// @brief Check whether period has elapsed since log site was last logged (used by LOG_EVERY_T)
+/// @param [in,out] next_log_time - Earliest time (in ns since steady clock epoch) at which log site is logged again
+/// @param [in] period - Minimum period between two logs of the log site
+inline bool ShouldLogEveryT(std::atomic<std::int64_t>& next_log_time, const std::chrono::nanoseconds period)
+{
+    const auto now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                         std::chrono::steady_clock::now().time_since_epoch())
+                         .count();
+    auto next = next_log_time.load(std::memory_order_relaxed);
+    // only one of the concurrent callers wins the race for the elapsed period
+    return ((now >= next) &&
+            next_log_time.compare_exchange_strong(next, now + period.count(), std::memory_order_relaxed));
+}
 }  // namespace perception
 
-/// @brief Log Stream with provided severity level
-/// @param [in] severity - Severity Level (INFO, WARN, ERROR, FATAL)
-#define LOG(severity) perception::LoggingWrapper(perception::LoggingWrapper::LogSeverity::severity).Stream()
+/// @brief Provide per-call-site state (each lambda expression owns its static variable)
+/// @param [in] type - Type of the state
+#define PERCEPTION_LOG_SITE_STATE(type)    \
+    []() -> std::atomic<type>& {           \
+        static std::atomic<type> state{0}; \
+        return state;                      \
+    }()
+
+/// @brief Log Stream with provided severity level. Stream is not formatted, if severity is filtered out.
+/// @param [in] severity - Severity Level (DEBUG, INFO, WARNING, ERROR, FATAL)
+#define LOG(severity)                                                                         \
+    !perception::LoggingWrapper::IsEnabled(perception::LoggingWrapper::LogSeverity::severity) \
+        ? static_cast<void>(0)                                                                \
+        : perception::LogMessageVoidify() &                                                   \
+              perception::LoggingWrapper(perception::LoggingWrapper::LogSeverity::severity).Stream()
+
+/// @brief Log Stream with provided severity level, if condition is true. Condition is evaluated only if severity is
+/// enabled, Stream is formatted only if both hold.
+/// @param [in] severity - Severity Level (DEBUG, INFO, WARNING, ERROR, FATAL)
+/// @param [in] condition - condition to be evaluated
+#define LOG_IF(severity, condition)                                                                          \
+    !(perception::LoggingWrapper::IsEnabled(perception::LoggingWrapper::LogSeverity::severity) && (condition)) \
+        ? static_cast<void>(0)                                                                               \
+        : perception::LogMessageVoidify() &                                                                  \
+              perception::LoggingWrapper(perception::LoggingWrapper::LogSeverity::severity).Stream()
+
+/// @brief Log Stream on the 1st, (n+1)th, (2n+1)th, ... occurrence of the log site
+/// @param [in] severity - Severity Level (DEBUG, INFO, WARNING, ERROR, FATAL)
+/// @param [in] n - Log every n-th occurrence (0: never)
+#define LOG_EVERY_N(severity, n) \
+    LOG_IF(severity, perception::ShouldLogEveryN(PERCEPTION_LOG_SITE_STATE(std::uint64_t), (n)))
+
+/// @brief Log Stream on the first n occurrences of the log site
+/// @param [in] severity - Severity Level (DEBUG, INFO, WARNING, ERROR, FATAL)
+/// @param [in] n - Number of occurrences to be logged
+#define LOG_FIRST_N(severity, n) \
+    LOG_IF(severity, perception::ShouldLogFirstN(PERCEPTION_LOG_SITE_STATE(std::uint64_t), (n)))
+
+/// @brief Log Stream at most once per period for the log site (first occurrence is always logged)
+/// @param [in] severity - Severity Level (DEBUG, INFO, WARNING, ERROR, FATAL)
+/// @param [in] period - Minimum period between two logs (std::chrono::duration)
+#define LOG_EVERY_T(severity, period) \
+    LOG_IF(severity, perception::ShouldLogEveryT(PERCEPTION_LOG_SITE_STATE(std::int64_t), (period)))
 
 /// @brief Checks for Assertion. If condition is false, Log FATAL Error and exit program.
 /// @param [in] condition - condition to be evaluated
-#define CHECK(condition) \
-    perception::LoggingWrapper(perception::LoggingWrapper::LogSeverity::FATAL, (condition) ? false : true).Stream()
+#define CHECK(condition)                            \
+    (condition) ? static_cast<void>(0)              \
+                : perception::LogMessageVoidify() & \
+                      perception::LoggingWrapper(perception::LoggingWrapper::LogSeverity::FATAL).Stream()
 
 /// @brief Checks for Assertion for Comparision. If a and b are not same, Log FATAL Error and exit program.
 /// @param [in] a - attribute a
@@ -2,48 +2,336 @@
 /// @file
 /// @copyright Copyright (c) 2023. MIT License.
 ///
+#include "perception/common/async_log_backend.h"
 #include "perception/common/logging.h"
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+
 namespace perception
 {
 namespace
 {
 
-TEST(LoggingTest, BasicLoggingMacro_INFO)
+class LoggingTest : public ::testing::Test
+{
+  protected:
+    void TearDown() override { LoggingWrapper::SetMinSeverity(LoggingWrapper::LogSeverity::DEBUG); }
+};
+
+/// @brief Provide string, counting number of times it is formatted (i.e. used to detect skipped formatting)
+std::string CountFormatting(std::int32_t& count)
+{
+    ++count;
+    return "formatted";
+}
+
+TEST_F(LoggingTest, BasicLoggingMacro_INFO)
 {
     const std::string test_log{"Sanity Test for LogSeverityLevel = INFO!!"};
     ::testing::internal::CaptureStdout();
 
     LOG(INFO) << test_log;
+    LoggingWrapper::Flush();
 
     const std::string result = ::testing::internal::GetCapturedStdout();
     EXPECT_THAT(result, ::testing::HasSubstr(test_log));
 }
 
-TEST(LoggingTest, BasicLoggingMacro_WARN)
+TEST_F(LoggingTest, BasicLoggingMacro_WARN)
 {
     const std::string test_log{"Sanity Test for LogSeverityLevel = WARNING!!"};
     ::testing::internal::CaptureStdout();
 
     LOG(WARNING) << test_log;
+    LoggingWrapper::Flush();
 
     const std::string result = ::testing::internal::GetCapturedStdout();
     EXPECT_THAT(result, ::testing::HasSubstr(test_log));
 }
 
-TEST(LoggingTest, BasicLoggingMacro_ERROR)
+TEST_F(LoggingTest, BasicLoggingMacro_ERROR)
 {
     const std::string test_log{"Sanity Test for LogSeverityLevel = ERROR!!"};
     ::testing::internal::CaptureStderr();
 
     LOG(ERROR) << test_log;
+    LoggingWrapper::Flush();
 
     const std::string result = ::testing::internal::GetCapturedStderr();
     EXPECT_THAT(result, ::testing::HasSubstr(test_log));
 }
 
+TEST_F(LoggingTest, LoggingMacro_GivenFilteredSeverity_ExpectNoFormatting)
+{
+    // Given
+    std::int32_t count{0};
+    LoggingWrapper::SetMinSeverity(LoggingWrapper::LogSeverity::WARNING);
+    ::testing::internal::CaptureStdout();
+
+    // When
+    LOG(DEBUG) << CountFormatting(count);
+    LOG(INFO) << CountFormatting(count);
+    LoggingWrapper::Flush();
+
+    // Then
+    const std::string result = ::testing::internal::GetCapturedStdout();
+    EXPECT_EQ(count, 0);
+    EXPECT_THAT(result, ::testing::Not(::testing::HasSubstr("formatted")));
+}
+
+TEST_F(LoggingTest, LoggingMacro_GivenEnabledSeverity_ExpectFormatting)
+{
+    // Given
+    std::int32_t count{0};
+    LoggingWrapper::SetMinSeverity(LoggingWrapper::LogSeverity::WARNING);
+    ::testing::internal::CaptureStdout();
+
+    // When
+    LOG(WARNING) << CountFormatting(count);
+    LoggingWrapper::Flush();
+
+    // Then
+    const std::string result = ::testing::internal::GetCapturedStdout();
+    EXPECT_EQ(count, 1);
+    EXPECT_THAT(result, ::testing::HasSubstr("formatted"));
+}
+
+TEST_F(LoggingTest, CheckMacro_GivenTrueCondition_ExpectNoFormatting)
+{
+    // Given
+    std::int32_t count{0};
+
+    // When
+    CHECK(count == 0) << CountFormatting(count);
+    CHECK_EQ(count, 0) << CountFormatting(count);
+
+    // Then
+    EXPECT_EQ(count, 0);
+}
+
+TEST_F(LoggingTest, CheckMacro_GivenFalseCondition_ExpectAbort)
+{
+    ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+    EXPECT_DEATH(CHECK(false) << "Sanity Test for CHECK!!", "Sanity Test for CHECK!!");
+}
+
+TEST_F(LoggingTest, LoggingMacro_GivenMultipleMessages_ExpectOrderPreserved)
+{
+    // Given
+    ::testing::internal::CaptureStdout();
+
+    // When
+    for (std::int32_t index = 0; index < 100; ++index)
+    {
+        LOG(INFO) << "message " << index << ";";
+    }
+    LoggingWrapper::Flush();
+
+    // Then
+    const std::string result = ::testing::internal::GetCapturedStdout();
+    std::size_t position{0U};
+    for (std::int32_t index = 0; index < 100; ++index)
+    {
+        const auto next_position = result.find("message " + std::to_string(index) + ";", position);
+        ASSERT_NE(next_position, std::string::npos) << "index: " << index;
+        position = next_position;
+    }
+}
+
+TEST_F(LoggingTest, LogEveryN_GivenMultipleOccurrences_ExpectEveryNthLogged)
+{
+    // Given
+    std::int32_t count{0};
+    ::testing::internal::CaptureStdout();
+
+    // When
+    for (std::int32_t index = 0; index < 10; ++index)
+    {
+        LOG_EVERY_N(INFO, 4) << CountFormatting(count);
+    }
+    LoggingWrapper::Flush();
+
+    // Then
+    ::testing::internal::GetCapturedStdout();
+    EXPECT_EQ(count, 3);
+}
+
+TEST_F(LoggingTest, LogEveryN_GivenZero_ExpectNothingLogged)
+{
+    // Given
+    std::int32_t count{0};
+    ::testing::internal::CaptureStdout();
+
+    // When
+    for (std::int32_t index = 0; index < 10; ++index)
+    {
+        LOG_EVERY_N(INFO, 0) << CountFormatting(count);
+    }
+    LoggingWrapper::Flush();
+
+    // Then
+    ::testing::internal::GetCapturedStdout();
+    EXPECT_EQ(count, 0);
+}
+
+TEST_F(LoggingTest, LogFirstN_GivenMultipleOccurrences_ExpectFirstNLogged)
+{
+    // Given
+    std::int32_t count{0};
+    ::testing::internal::CaptureStdout();
+
+    // When
+    for (std::int32_t index = 0; index < 10; ++index)
+    {
+        LOG_FIRST_N(INFO, 3) << CountFormatting(count);
+    }
+    LoggingWrapper::Flush();
+
+    // Then
+    ::testing::internal::GetCapturedStdout();
+    EXPECT_EQ(count, 3);
+}
+
+TEST_F(LoggingTest, LogEveryT_GivenOccurrencesWithinPeriod_ExpectFirstLogged)
+{
+    // Given
+    std::int32_t count{0};
+    ::testing::internal::CaptureStdout();
+
+    // When
+    for (std::int32_t index = 0; index < 10; ++index)
+    {
+        LOG_EVERY_T(INFO, std::chrono::hours{1}) << CountFormatting(count);
+    }
+    LoggingWrapper::Flush();
+
+    // Then
+    ::testing::internal::GetCapturedStdout();
+    EXPECT_EQ(count, 1);
+}
+
+TEST_F(LoggingTest, LogEveryT_GivenElapsedPeriod_ExpectLoggedAgain)
+{
+    // Given
+    std::int32_t count{0};
+    ::testing::internal::CaptureStdout();
+
+    // When
+    for (std::int32_t index = 0; index < 2; ++index)
+    {
+        LOG_EVERY_T(INFO, std::chrono::milliseconds{1}) << CountFormatting(count);
+        std::this_thread::sleep_for(std::chrono::milliseconds{2});
+    }
+    LoggingWrapper::Flush();
+
+    // Then
+    ::testing::internal::GetCapturedStdout();
+    EXPECT_EQ(count, 2);
+}
+
+TEST_F(LoggingTest, LogEveryN_GivenFilteredSeverity_ExpectNoFormatting)
+{
+    // Given
+    std::int32_t count{0};
+    LoggingWrapper::SetMinSeverity(LoggingWrapper::LogSeverity::WARNING);
+
+    // When
+    for (std::int32_t index = 0; index < 10; ++index)
+    {
+        LOG_EVERY_N(INFO, 2) << CountFormatting(count);
+    }
+
+    // Then
+    EXPECT_EQ(count, 0);
+}
+
+TEST_F(LoggingTest, LogFirstN_GivenConcurrentOccurrences_ExpectExactlyFirstNLogged)
+{
+    // Given
+    std::atomic<std::int32_t> count{0};
+    const auto log = [&count]() {
+        for (std::int32_t index = 0; index < 1000; ++index)
+        {
+            LOG_FIRST_N(DEBUG, 5) << count.fetch_add(1);
+        }
+    };
+    ::testing::internal::CaptureStdout();
+
+    // When
+    std::thread first_thread{log};
+    std::thread second_thread{log};
+    first_thread.join();
+    second_thread.join();
+    LoggingWrapper::Flush();
+
+    // Then
+    ::testing::internal::GetCapturedStdout();
+    EXPECT_EQ(count.load(), 5);
+}
+
+TEST(AsyncLogBackendTest, Log_GivenFullRingBuffer_ExpectDroppedMessagesCounted)
+{
+    // Given
+    auto backend = std::make_unique<AsyncLogBackend>();
+    ::testing::internal::CaptureStdout();
+    ::testing::internal::CaptureStderr();
+
+    // When
+    std::int64_t number_of_enqueued_messages{0};
+    for (std::size_t index = 0U; index < (4U * AsyncLogBackend::kCapacity); ++index)
+    {
+        number_of_enqueued_messages += backend->Log(LoggingWrapper::LogSeverity::INFO, "message") ? 1 : 0;
+    }
+    backend->Shutdown();
+
+    // Then
+    ::testing::internal::GetCapturedStdout();
+    const std::string errors = ::testing::internal::GetCapturedStderr();
+    EXPECT_EQ(number_of_enqueued_messages + backend->GetNumberOfDroppedMessages(),
+              static_cast<std::int64_t>(4U * AsyncLogBackend::kCapacity));
+    if (backend->GetNumberOfDroppedMessages() > 0)
+    {
+        EXPECT_THAT(errors, ::testing::HasSubstr("dropped"));
+    }
+}
+
+TEST(AsyncLogBackendTest, Log_GivenLongMessage_ExpectTruncated)
+{
+    // Given
+    auto backend = std::make_unique<AsyncLogBackend>();
+    const std::string message(2U * AsyncLogBackend::kMaxMessageLength, 'x');
+    ::testing::internal::CaptureStdout();
+
+    // When
+    EXPECT_TRUE(backend->Log(LoggingWrapper::LogSeverity::INFO, message));
+    backend->Flush();
+
+    // Then
+    const std::string result = ::testing::internal::GetCapturedStdout();
+    EXPECT_EQ(result, std::string(AsyncLogBackend::kMaxMessageLength, 'x') + "\n");
+}
+
+TEST(AsyncLogBackendTest, Log_GivenShutdownBackend_ExpectSynchronousWrite)
+{
+    // Given
+    auto backend = std::make_unique<AsyncLogBackend>();
+    backend->Shutdown();
+    ::testing::internal::CaptureStderr();
+
+    // When
+    EXPECT_TRUE(backend->Log(LoggingWrapper::LogSeverity::ERROR, "after shutdown"));
+
+    // Then
+    const std::string result = ::testing::internal::GetCapturedStderr();
+    EXPECT_THAT(result, ::testing::HasSubstr("after shutdown"));
+}
+
 }  // namespace
 }  // namespace perception
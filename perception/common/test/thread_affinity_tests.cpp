@@ -0,0 +1,92 @@
+///
+/// @file
+/// @copyright Copyright (c) 2023. MIT License.
+///
+#include "perception/common/thread_affinity.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <thread>
+
+namespace perception
+{
+namespace
+{
+class ThreadAffinityFixture : public ::testing::Test
+{
+  public:
+    ThreadAffinityFixture() : initial_cpu_affinity_mask_{GetThreadAffinity()} {}
+
+  protected:
+    void TearDown() override { SetThreadAffinity(initial_cpu_affinity_mask_); }
+
+    /// @brief Mask of the lowest CPU, available to the calling thread
+    std::uint64_t GetFirstAvailableCpu() const
+    {
+        return initial_cpu_affinity_mask_ & (~initial_cpu_affinity_mask_ + 1U);
+    }
+
+    const std::uint64_t initial_cpu_affinity_mask_;
+};
+
+TEST_F(ThreadAffinityFixture, SetThreadAffinity_GivenAvailableCpu_ExpectPinnedThread)
+{
+    // Given
+    ASSERT_NE(initial_cpu_affinity_mask_, 0U);
+    const auto cpu_affinity_mask = GetFirstAvailableCpu();
+
+    // When
+    const auto applied = SetThreadAffinity(cpu_affinity_mask);
+
+    // Then
+    EXPECT_TRUE(applied);
+    EXPECT_EQ(GetThreadAffinity(), cpu_affinity_mask);
+}
+
+TEST_F(ThreadAffinityFixture, SetThreadAffinity_GivenPinnedThread_ExpectInheritedBySpawnedThread)
+{
+    // Given
+    const auto cpu_affinity_mask = GetFirstAvailableCpu();
+    ASSERT_TRUE(SetThreadAffinity(cpu_affinity_mask));
+
+    // When
+    std::uint64_t spawned_cpu_affinity_mask{0U};
+    std::thread spawned{[&spawned_cpu_affinity_mask] { spawned_cpu_affinity_mask = GetThreadAffinity(); }};
+    spawned.join();
+
+    // Then
+    EXPECT_EQ(spawned_cpu_affinity_mask, cpu_affinity_mask);
+}
+
+TEST_F(ThreadAffinityFixture, ScopedThreadAffinity_GivenScopeLeft_ExpectPreviousAffinityOnlyForCallingThread)
+{
+    // Given
+    const auto cpu_affinity_mask = GetFirstAvailableCpu();
+    std::uint64_t spawned_cpu_affinity_mask{0U};
+    std::thread spawned{};
+
+    // When
+    {
+        const ScopedThreadAffinity scoped_thread_affinity{cpu_affinity_mask};
+        spawned = std::thread{[&spawned_cpu_affinity_mask] { spawned_cpu_affinity_mask = GetThreadAffinity(); }};
+    }
+    spawned.join();
+
+    // Then
+    EXPECT_EQ(GetThreadAffinity(), initial_cpu_affinity_mask_);
+    EXPECT_EQ(spawned_cpu_affinity_mask, cpu_affinity_mask);
+}
+
+TEST_F(ThreadAffinityFixture, SetThreadAffinity_GivenEmptyMask_ExpectUnchangedAffinity)
+{
+    // When
+    const auto applied = SetThreadAffinity(0U);
+
+    // Then
+    EXPECT_TRUE(applied);
+    EXPECT_EQ(GetThreadAffinity(), initial_cpu_affinity_mask_);
+}
+}  // namespace
+}  // namespace perception
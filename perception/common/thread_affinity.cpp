@@ -0,0 +1,87 @@
+///
+/// @file
+/// @copyright Copyright (c) 2023. MIT License
+///
+#include "perception/common/thread_affinity.h"
+
+#include "perception/common/logging.h"
+
+#include <pthread.h>
+#include <sched.h>
+
+#include <climits>
+#include <cstddef>
+#include <ios>
+
+namespace perception
+{
+namespace
+{
+/// @brief Number of CPUs which can be represented by the mask
+constexpr std::size_t kMaxNumberOfCpus{sizeof(std::uint64_t) * CHAR_BIT};
+}  // namespace
+
+bool SetThreadAffinity(const std::uint64_t cpu_affinity_mask)
+{
+    if (cpu_affinity_mask == 0U)
+    {
+        return true;
+    }
+
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (std::size_t cpu = 0U; cpu < kMaxNumberOfCpus; ++cpu)
+    {
+        if ((cpu_affinity_mask & (std::uint64_t{1U} << cpu)) != 0U)
+        {
+            CPU_SET(cpu, &cpu_set);
+        }
+    }
+    return pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set) == 0;
+}
+
+std::uint64_t GetThreadAffinity()
+{
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    if (pthread_getaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set) != 0)
+    {
+        return 0U;
+    }
+
+    std::uint64_t cpu_affinity_mask{0U};
+    for (std::size_t cpu = 0U; cpu < kMaxNumberOfCpus; ++cpu)
+    {
+        if (CPU_ISSET(cpu, &cpu_set))
+        {
+            cpu_affinity_mask |= (std::uint64_t{1U} << cpu);
+        }
+    }
+    return cpu_affinity_mask;
+}
+
+ScopedThreadAffinity::ScopedThreadAffinity(const std::uint64_t cpu_affinity_mask) : previous_cpu_set_{}, pinned_{false}
+{
+    if (cpu_affinity_mask == 0U)
+    {
+        return;
+    }
+    if (pthread_getaffinity_np(pthread_self(), sizeof(previous_cpu_set_), &previous_cpu_set_) != 0)
+    {
+        LOG(WARNING) << "Unable to read CPU affinity, CPU affinity mask 0x" << std::hex << cpu_affinity_mask
+                     << std::dec << " is not applied";
+        return;
+    }
+
+    pinned_ = SetThreadAffinity(cpu_affinity_mask);
+    LOG_IF(WARNING, !pinned_) << "Unable to set CPU affinity mask 0x" << std::hex << cpu_affinity_mask << std::dec;
+}
+
+ScopedThreadAffinity::~ScopedThreadAffinity()
+{
+    if (pinned_)
+    {
+        pthread_setaffinity_np(pthread_self(), sizeof(previous_cpu_set_), &previous_cpu_set_);
+    }
+}
+}  // namespace perception
@@ -0,0 +1,52 @@
+///
+/// @file
+/// @copyright Copyright (c) 2023. MIT License
+///
+#ifndef PERCEPTION_COMMON_THREAD_AFFINITY_H
+#define PERCEPTION_COMMON_THREAD_AFFINITY_H
+
+#include <sched.h>
+
+#include <cstdint>
+
+namespace perception
+{
+/// @brief Pin calling thread to the CPUs of the given mask. Threads spawned afterwards by the calling thread (e.g.
+/// backend thread pools) inherit the affinity.
+///
+/// @param cpu_affinity_mask [in] CPU mask (bit N: CPU N, 0: thread is not pinned)
+///
+/// @return True if affinity is applied (or not requested), otherwise False (e.g. mask without online CPUs).
+bool SetThreadAffinity(const std::uint64_t cpu_affinity_mask);
+
+/// @brief Provide CPU mask of the calling thread
+///
+/// @return CPU mask (bit N: CPU N) restricted to the first 64 CPUs, 0 on failure.
+std::uint64_t GetThreadAffinity();
+
+/// @brief Pins the calling thread for the lifetime of the object and restores its previous affinity afterwards, i.e.
+/// only threads spawned within the scope (e.g. backend thread pools) keep the affinity.
+class ScopedThreadAffinity final
+{
+  public:
+    /// @brief Constructor.
+    ///
+    /// @param cpu_affinity_mask [in] CPU mask (bit N: CPU N, 0: thread is not pinned)
+    explicit ScopedThreadAffinity(const std::uint64_t cpu_affinity_mask);
+
+    /// @brief Destructor (restores previous affinity of the calling thread)
+    ~ScopedThreadAffinity();
+
+    ScopedThreadAffinity(const ScopedThreadAffinity&) = delete;
+    ScopedThreadAffinity& operator=(const ScopedThreadAffinity&) = delete;
+
+  private:
+    /// @brief Affinity of the calling thread before pinning (all CPUs, not limited to the first 64)
+    cpu_set_t previous_cpu_set_;
+
+    /// @brief Thread has been pinned (i.e. previous affinity has to be restored)
+    bool pinned_;
+};
+}  // namespace perception
+
+#endif  /// PERCEPTION_COMMON_THREAD_AFFINITY_H
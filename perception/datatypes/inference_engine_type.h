@@ -7,6 +7,8 @@
 
 #include <opencv4/opencv2/core.hpp>
 
+#include <chrono>
+#include <cstdint>
 #include <ostream>
 #include <string>
 
@@ -19,6 +21,7 @@ enum class InferenceEngineType : std::uint8_t
     kTensorFlow = 1U,
     kTorch = 2U,
     kOpenCV = 3U,
+    kOnnxRuntime = 4U,
     kInvalid = 255U
 };
 
@@ -36,6 +39,105 @@ struct InferenceEngineParameters
 
     /// @brief Path to Model configurations
     std::string config_path{};
+
+    /// @brief Convert input images from BGR (OpenCV) to RGB channel order, as expected by the models
+    bool swap_red_blue{true};
+
+    /// @brief Model input size, for models which do not declare it (e.g. TorchScript) or declare a dynamic one
+    /// (empty: input size declared by the model, otherwise images are fed at their own size)
+    cv::Size input_size{};
+
+    /// @brief Scale applied to each pixel of float model inputs, i.e. pixel * input_scale + input_offset (e.g. 1/255
+    /// for [0, 1] inputs), TensorFlow Lite inputs are normalized with their fixed mean/stddev or quantization
+    float input_scale{1.0F};
+
+    /// @brief Offset added to each scaled pixel of float model inputs (e.g. -1 with 1/127.5 scale for [-1, 1] inputs)
+    float input_offset{0.0F};
+
+    /// @brief Number of threads used to parallelize execution of a single operation (0: unspecified, i.e. granted a
+    /// share of the thread budget by InferenceEnginePool, at least one thread once the budget is exhausted)
+    std::int32_t intra_op_threads{0};
+
+    /// @brief Number of threads used to execute independent operations in parallel (0: unspecified, i.e. granted a
+    /// share of the thread budget by InferenceEnginePool, at least one thread once the budget is exhausted)
+    std::int32_t inter_op_threads{0};
+
+    /// @brief CPUs to which the backend threads spawned while initialising the engine are pinned, the initialising
+    /// thread keeps its own affinity (bit N: CPU N, 0: not pinned)
+    std::uint64_t cpu_affinity_mask{0U};
+
+    /// @brief Enable backend graph optimizations (e.g. constant folding, operator fusion)
+    bool graph_optimization{true};
+
+    /// @brief Enable XLA JIT compilation of the graph (TensorFlow only)
+    bool xla_jit{false};
+
+    /// @brief Run supported operations with the XNNPACK CPU delegate, using intra_op_threads (TensorFlow Lite only)
+    bool xnnpack_delegate{true};
+
+    /// @brief Number of synthetic inferences run at the end of Init, so that lazy allocations and graph
+    /// optimizations are not paid by the first real frame (0: no warm-up)
+    std::int32_t warm_up_iterations{0};
+};
+
+/// @brief Tiled execution of (high resolution) frames, i.e. tiles of a region of interest are executed as a single
+/// batch at model resolution and detections are merged back to frame coordinates
+struct TilingParameters
+{
+    /// @brief Region of interest, relative to the frame size (e.g. horizon band), whole frame by default
+    cv::Rect2f region_of_interest{0.0F, 0.0F, 1.0F, 1.0F};
+
+    /// @brief Number of tiles along the width of the region of interest
+    std::int32_t number_of_columns{1};
+
+    /// @brief Number of tiles along the height of the region of interest
+    std::int32_t number_of_rows{1};
+
+    /// @brief Overlap of adjacent tiles, relative to the tile size, so that objects on tile borders are fully seen by
+    /// at least one tile
+    float overlap{0.2F};
+
+    /// @brief Intersection over union above which detections of the same class from different tiles are merged
+    float merge_iou_threshold{0.5F};
+};
+
+/// @brief Input tensor expected by the model (per image of the batch)
+struct InputTensorInfo
+{
+    /// @brief Input size (empty: dynamic, i.e. images are fed at their own size)
+    cv::Size size{};
+
+    /// @brief Number of channels
+    std::int32_t channels{3};
+
+    /// @brief Element type of the input tensor (OpenCV depth, e.g. CV_8U, CV_32F)
+    std::int32_t depth{CV_8U};
+};
+
+/// @brief Latencies measured while warming up the Inference Engine
+struct WarmUpStatistics
+{
+    /// @brief Number of warm-up inferences
+    std::int32_t iterations{0};
+
+    /// @brief Latency of the first inference
+    std::chrono::microseconds cold_latency{0};
+
+    /// @brief Mean latency of the subsequent inferences (0, if only a single inference has been run)
+    std::chrono::microseconds warm_latency{0};
+};
+
+/// @brief Latencies of the stages of a single inference
+struct InferenceStageLatencies
+{
+    /// @brief Conversion of the input images to the input tensor (e.g. resize, normalization)
+    std::chrono::microseconds preprocess{0};
+
+    /// @brief Model run
+    std::chrono::microseconds invoke{0};
+
+    /// @brief Conversion of the output tensors to results
+    std::chrono::microseconds postprocess{0};
 };
 
 inline const char* to_string(const InferenceEngineType& inference_engine_type)
@@ -50,6 +152,8 @@ inline const char* to_string(const InferenceEngineType& inference_engine_type)
             return "kTorch";
         case InferenceEngineType::kOpenCV:
             return "kOpenCV";
+        case InferenceEngineType::kOnnxRuntime:
+            return "kOnnxRuntime";
         default:
             return "ERROR: Unknown InferenceEngineType.";
     }
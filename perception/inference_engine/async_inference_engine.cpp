@@ -0,0 +1,150 @@
+///
+/// @file
+/// @copyright Copyright (c) 2023. MIT License
+///
+#include "perception/inference_engine/async_inference_engine.h"
+
+#include "perception/common/logging.h"
+
+#include <opencv4/opencv2/imgproc.hpp>
+
+#include <algorithm>
+#include <exception>
+#include <utility>
+
+namespace perception
+{
+
+constexpr std::size_t AsyncInferenceEngine::kNumberOfContexts;
+
+AsyncInferenceEngine::AsyncInferenceEngine(IInferenceEngine& engine)
+    : engine_{engine},
+      input_size_{},
+      contexts_{{Context{Image{}, Results{}, std::promise<const Results&>{}, false},
+                 Context{Image{}, Results{}, std::promise<const Results&>{}, false}}},
+      next_context_{0U},
+      pending_contexts_{},
+      mutex_{},
+      condition_{},
+      running_{false},
+      worker_{}
+{
+}
+
+AsyncInferenceEngine::~AsyncInferenceEngine()
+{
+    Stop();
+}
+
+void AsyncInferenceEngine::Init()
+{
+    CHECK(!worker_.joinable()) << "Inference Engine is already running.";
+
+    // read from the initialised model, so that images are resized by the caller rather than by the worker thread
+    input_size_ = engine_.GetInputTensorInfo().size;
+
+    running_ = true;
+    worker_ = std::thread{&AsyncInferenceEngine::Run, this};
+}
+
+std::future<const AsyncInferenceEngine::Results&> AsyncInferenceEngine::Submit(const Image& image)
+{
+    std::unique_lock<std::mutex> lock{mutex_};
+    CHECK(running_) << "Inference Engine is not running.";
+
+    const auto index = next_context_;
+    auto& context = contexts_.at(index);
+    condition_.wait(lock, [&context] { return !context.busy; });
+    context.busy = true;
+    next_context_ = (index + 1U) % kNumberOfContexts;
+
+    // context is not accessed by worker thread until it is pending, hence input is resized without holding the lock
+    // (i.e. overlaps with inference of the other context)
+    lock.unlock();
+    if (input_size_.empty())
+    {
+        image.copyTo(context.image);
+    }
+    else
+    {
+        cv::resize(image, context.image, input_size_, 0.0, 0.0, cv::INTER_LINEAR);
+    }
+    context.promise = std::promise<const Results&>{};
+    auto future = context.promise.get_future();
+
+    lock.lock();
+    pending_contexts_.push_back(index);
+    lock.unlock();
+
+    condition_.notify_all();
+    return future;
+}
+
+void AsyncInferenceEngine::Wait()
+{
+    std::unique_lock<std::mutex> lock{mutex_};
+    condition_.wait(lock, [this] {
+        return std::none_of(contexts_.cbegin(), contexts_.cend(), [](const auto& context) { return context.busy; });
+    });
+}
+
+void AsyncInferenceEngine::Shutdown()
+{
+    Stop();
+}
+
+void AsyncInferenceEngine::Stop()
+{
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+        running_ = false;
+    }
+    condition_.notify_all();
+    if (worker_.joinable())
+    {
+        worker_.join();
+    }
+}
+
+void AsyncInferenceEngine::Run()
+{
+    while (true)
+    {
+        std::unique_lock<std::mutex> lock{mutex_};
+        condition_.wait(lock, [this] { return !pending_contexts_.empty() || !running_; });
+        if (pending_contexts_.empty())
+        {
+            // stopped and all the submitted contexts are completed
+            break;
+        }
+        auto& context = contexts_.at(pending_contexts_.front());
+        pending_contexts_.pop_front();
+        lock.unlock();
+
+        try
+        {
+            engine_.Execute(context.image);
+
+            // engine results are views on its output tensors, which are overwritten by the next frame
+            const auto& results = engine_.GetResults();
+            context.results.resize(results.size());
+            for (std::size_t index = 0U; index < results.size(); ++index)
+            {
+                // reallocates only if output shape/type changes
+                results.at(index).copyTo(context.results.at(index));
+            }
+            context.promise.set_value(context.results);
+        }
+        catch (...)
+        {
+            context.promise.set_exception(std::current_exception());
+        }
+
+        lock.lock();
+        context.busy = false;
+        lock.unlock();
+        condition_.notify_all();
+    }
+}
+
+}  // namespace perception
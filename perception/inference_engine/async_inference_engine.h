@@ -0,0 +1,119 @@
+///
+/// @file
+/// @copyright Copyright (c) 2023. MIT License
+///
+#ifndef PERCEPTION_INFERENCE_ENGINE_ASYNC_INFERENCE_ENGINE_H
+#define PERCEPTION_INFERENCE_ENGINE_ASYNC_INFERENCE_ENGINE_H
+
+#include "perception/inference_engine/i_inference_engine.h"
+
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace perception
+{
+/// @brief Asynchronous Inference Engine. Images are submitted to a worker thread, which runs the model, and results
+/// are provided through futures, hence caller (i.e. node Step) does not block for the duration of the model run.
+///
+/// A single Inference Engine (i.e. a single loaded model) is shared by two contexts (double buffering), each with its
+/// own input image and results. Submit resizes the image to the model input size into the next context on the
+/// caller's thread, while the worker thread runs the model for the previous context. The remaining preprocessing
+/// (channel order, normalization and layout conversion of the resized image) is done by the Inference Engine on the
+/// worker thread.
+///
+/// @note Results of a frame are copied from the Inference Engine into its context and remain valid until the context
+/// is reused, i.e. until the frame after the next one is submitted.
+/// @note Submit, Wait and Shutdown are expected to be called from a single (i.e. node's) thread.
+class AsyncInferenceEngine final
+{
+  public:
+    /// @brief Results of a single frame (see IInferenceEngine::GetResults)
+    using Results = std::vector<cv::Mat>;
+
+    /// @brief Number of contexts (double buffered)
+    static constexpr std::size_t kNumberOfContexts{2U};
+
+    /// @brief Constructor
+    ///
+    /// @param engine [in] Initialised Inference Engine (not owned, must outlive AsyncInferenceEngine and must not be
+    /// executed by others while frames are in flight)
+    explicit AsyncInferenceEngine(IInferenceEngine& engine);
+
+    /// @brief Destructor (stops worker thread, if still running)
+    ~AsyncInferenceEngine();
+
+    /// @brief Start worker thread
+    void Init();
+
+    /// @brief Submit image for inference. Blocks only if the context to be used is still busy (i.e. caller is more
+    /// than one frame ahead of the worker thread).
+    ///
+    /// @param image [in] Image to be fed as input to Inference Engine (resized into the context on the caller's thread)
+    ///
+    /// @return Future providing results of the image, once inference is completed
+    std::future<const Results&> Submit(const Image& image);
+
+    /// @brief Wait until all the submitted frames are completed (i.e. Inference Engine is idle)
+    void Wait();
+
+    /// @brief Finish pending inferences and stop worker thread (Inference Engine is released by its owner)
+    void Shutdown();
+
+  private:
+    /// @brief Context (input and results of a single in-flight frame)
+    struct Context
+    {
+        /// @brief Input image, resized to the model input size (buffer reused for each frame)
+        Image image;
+
+        /// @brief Results of the frame (buffers reused for each frame)
+        Results results;
+
+        /// @brief Promise for the results of the submitted frame
+        std::promise<const Results&> promise;
+
+        /// @brief Context is submitted and not yet completed
+        bool busy;
+    };
+
+    /// @brief Stop worker thread, after all the submitted contexts are completed
+    void Stop();
+
+    /// @brief Worker thread loop, executing submitted contexts in submission order
+    void Run();
+
+    /// @brief Inference Engine shared by all contexts
+    IInferenceEngine& engine_;
+
+    /// @brief Model input size (empty: images are fed at their own size)
+    cv::Size input_size_;
+
+    /// @brief Contexts
+    std::array<Context, kNumberOfContexts> contexts_;
+
+    /// @brief Index of the context to be used for the next submission
+    std::size_t next_context_;
+
+    /// @brief Indices of submitted contexts, pending for execution
+    std::deque<std::size_t> pending_contexts_;
+
+    /// @brief Guards contexts_ state, pending_contexts_ and running_
+    std::mutex mutex_;
+
+    /// @brief Signals submitted and completed contexts
+    std::condition_variable condition_;
+
+    /// @brief Worker thread is running
+    bool running_;
+
+    /// @brief Worker thread
+    std::thread worker_;
+};
+}  // namespace perception
+#endif  /// PERCEPTION_INFERENCE_ENGINE_ASYNC_INFERENCE_ENGINE_H
@@ -0,0 +1,197 @@
+///
+/// @file
+/// @copyright Copyright (c) 2023. MIT License
+///
+#include "perception/inference_engine/detection_tiling.h"
+
+#include "perception/common/logging.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace perception
+{
+namespace
+{
+/// @brief Detection in frame coordinates (relative to the frame size)
+struct Detection
+{
+    /// @brief Class (label id)
+    float label;
+
+    /// @brief Confidence score
+    float score;
+
+    /// @brief Bounding box
+    cv::Rect2f box;
+};
+
+/// @brief Provide tile length, so that count tiles overlapping by overlap cover the region
+///
+/// @param region_length [in] Length of the region of interest (in pixels)
+/// @param count [in] Number of tiles along the region
+/// @param overlap [in] Overlap of adjacent tiles, relative to the tile length
+///
+/// @return Tile length (in pixels)
+std::int32_t GetTileLength(const std::int32_t region_length, const std::int32_t count, const float overlap)
+{
+    const auto length =
+        static_cast<float>(region_length) / ((static_cast<float>(count) * (1.0F - overlap)) + overlap);
+    return std::min(region_length, std::max(1, static_cast<std::int32_t>(std::lround(length))));
+}
+
+/// @brief Provide offset of the tile, with tiles evenly distributed over the region
+///
+/// @param index [in] Index of the tile along the region
+/// @param count [in] Number of tiles along the region
+/// @param region_start [in] Start of the region of interest (in pixels)
+/// @param region_length [in] Length of the region of interest (in pixels)
+/// @param tile_length [in] Tile length (in pixels)
+///
+/// @return Tile offset (in pixels)
+std::int32_t GetTileOffset(const std::int32_t index,
+                           const std::int32_t count,
+                           const std::int32_t region_start,
+                           const std::int32_t region_length,
+                           const std::int32_t tile_length)
+{
+    return (count > 1) ? (region_start + ((index * (region_length - tile_length)) / (count - 1))) : region_start;
+}
+
+/// @brief Provide intersection over union of two boxes
+float GetIntersectionOverUnion(const cv::Rect2f& first, const cv::Rect2f& second)
+{
+    const auto intersection = (first & second).area();
+    const auto union_area = first.area() + second.area() - intersection;
+    return (union_area > 0.0F) ? (intersection / union_area) : 0.0F;
+}
+}  // namespace
+
+bool IsTilingEnabled(const TilingParameters& tiling_parameters)
+{
+    return (tiling_parameters.number_of_columns > 1) || (tiling_parameters.number_of_rows > 1) ||
+           (tiling_parameters.region_of_interest != cv::Rect2f{0.0F, 0.0F, 1.0F, 1.0F});
+}
+
+std::vector<cv::Rect> GetTiles(const cv::Size& image_size, const TilingParameters& tiling_parameters)
+{
+    CHECK((tiling_parameters.number_of_columns > 0) && (tiling_parameters.number_of_rows > 0))
+        << "Received invalid number of tiles " << tiling_parameters.number_of_columns << "x"
+        << tiling_parameters.number_of_rows;
+    CHECK((tiling_parameters.overlap >= 0.0F) && (tiling_parameters.overlap < 1.0F))
+        << "Received invalid tile overlap " << tiling_parameters.overlap;
+
+    const auto& roi = tiling_parameters.region_of_interest;
+    const cv::Rect region = cv::Rect{static_cast<std::int32_t>(std::lround(roi.x * image_size.width)),
+                                     static_cast<std::int32_t>(std::lround(roi.y * image_size.height)),
+                                     static_cast<std::int32_t>(std::lround(roi.width * image_size.width)),
+                                     static_cast<std::int32_t>(std::lround(roi.height * image_size.height))} &
+                            cv::Rect{0, 0, image_size.width, image_size.height};
+    CHECK(!region.empty()) << "Region of interest does not intersect with " << image_size.width << "x"
+                           << image_size.height << " frame";
+
+    const auto tile_width = GetTileLength(region.width, tiling_parameters.number_of_columns, tiling_parameters.overlap);
+    const auto tile_height = GetTileLength(region.height, tiling_parameters.number_of_rows, tiling_parameters.overlap);
+
+    std::vector<cv::Rect> tiles{};
+    tiles.reserve(static_cast<std::size_t>(tiling_parameters.number_of_columns * tiling_parameters.number_of_rows));
+    for (std::int32_t row = 0; row < tiling_parameters.number_of_rows; ++row)
+    {
+        const auto y = GetTileOffset(row, tiling_parameters.number_of_rows, region.y, region.height, tile_height);
+        for (std::int32_t column = 0; column < tiling_parameters.number_of_columns; ++column)
+        {
+            const auto x =
+                GetTileOffset(column, tiling_parameters.number_of_columns, region.x, region.width, tile_width);
+            tiles.emplace_back(x, y, tile_width, tile_height);
+        }
+    }
+    return tiles;
+}
+
+void MergeDetections(const std::vector<std::vector<cv::Mat>>& tile_results,
+                     const std::vector<cv::Rect>& tiles,
+                     const cv::Size& image_size,
+                     const float merge_iou_threshold,
+                     std::vector<cv::Mat>& results)
+{
+    CHECK_EQ(tile_results.size(), tiles.size()) << "Received results for " << tile_results.size() << " tiles, expected "
+                                                << tiles.size();
+
+    const auto frame_width = static_cast<float>(image_size.width);
+    const auto frame_height = static_cast<float>(image_size.height);
+
+    std::vector<Detection> detections{};
+    std::int32_t max_detections{0};
+    for (std::size_t index = 0U; index < tiles.size(); ++index)
+    {
+        const auto& tile_result = tile_results.at(index);
+        CHECK(tile_result.size() > kNumDetectionsIndex)
+            << "Tiled execution requires detection outputs (classes, scores, boxes, num_detections)";
+        const auto& classes = tile_result.at(kDetectionClassesIndex);
+        const auto& scores = tile_result.at(kDetectionScoresIndex);
+        const auto& boxes = tile_result.at(kDetectionBoxesIndex);
+        const auto& num_detections = tile_result.at(kNumDetectionsIndex);
+        const auto& tile = tiles.at(index);
+
+        max_detections = std::max(max_detections, boxes.rows);
+        const auto number_of_detections =
+            num_detections.empty() ? 0
+                                   : std::min(static_cast<std::int32_t>(num_detections.at<float>(0, 0)), boxes.rows);
+        for (std::int32_t idx = 0; idx < number_of_detections; ++idx)
+        {
+            const auto ymin = boxes.at<float>(idx, 0);
+            const auto xmin = boxes.at<float>(idx, 1);
+            const auto ymax = boxes.at<float>(idx, 2);
+            const auto xmax = boxes.at<float>(idx, 3);
+            const cv::Rect2f box{(static_cast<float>(tile.x) + (xmin * static_cast<float>(tile.width))) / frame_width,
+                                 (static_cast<float>(tile.y) + (ymin * static_cast<float>(tile.height))) / frame_height,
+                                 ((xmax - xmin) * static_cast<float>(tile.width)) / frame_width,
+                                 ((ymax - ymin) * static_cast<float>(tile.height)) / frame_height};
+            detections.push_back(Detection{classes.at<float>(idx, 0), scores.at<float>(idx, 0), box});
+        }
+    }
+
+    // greedy non-maximum suppression, per class
+    std::stable_sort(detections.begin(), detections.end(), [](const auto& first, const auto& second) {
+        return first.score > second.score;
+    });
+    auto merged_end = detections.begin();
+    for (auto candidate = detections.begin(); candidate != detections.end(); ++candidate)
+    {
+        const auto suppressed = std::any_of(detections.begin(), merged_end, [&](const auto& merged) {
+            return (merged.label == candidate->label) &&
+                   (GetIntersectionOverUnion(merged.box, candidate->box) > merge_iou_threshold);
+        });
+        if (!suppressed)
+        {
+            *merged_end = *candidate;
+            ++merged_end;
+        }
+    }
+    detections.erase(merged_end, detections.end());
+
+    results.resize(kNumDetectionsIndex + 1U);
+    results.at(kDetectionClassesIndex).create(max_detections, 1, CV_32F);
+    results.at(kDetectionScoresIndex).create(max_detections, 1, CV_32F);
+    results.at(kDetectionBoxesIndex).create(max_detections, 4, CV_32F);
+    results.at(kNumDetectionsIndex).create(1, 1, CV_32F);
+    for (auto& result : results)
+    {
+        result.setTo(cv::Scalar::all(0));
+    }
+
+    const auto number_of_detections = std::min(static_cast<std::int32_t>(detections.size()), max_detections);
+    for (std::int32_t idx = 0; idx < number_of_detections; ++idx)
+    {
+        const auto& detection = detections.at(static_cast<std::size_t>(idx));
+        results.at(kDetectionClassesIndex).at<float>(idx, 0) = detection.label;
+        results.at(kDetectionScoresIndex).at<float>(idx, 0) = detection.score;
+        auto& boxes = results.at(kDetectionBoxesIndex);
+        boxes.at<float>(idx, 0) = detection.box.y;
+        boxes.at<float>(idx, 1) = detection.box.x;
+        boxes.at<float>(idx, 2) = detection.box.y + detection.box.height;
+        boxes.at<float>(idx, 3) = detection.box.x + detection.box.width;
+    }
+    results.at(kNumDetectionsIndex).at<float>(0, 0) = static_cast<float>(number_of_detections);
+}
+}  // namespace perception
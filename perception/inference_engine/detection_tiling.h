@@ -0,0 +1,60 @@
+///
+/// @file
+/// @copyright Copyright (c) 2023. MIT License
+///
+#ifndef PERCEPTION_INFERENCE_ENGINE_DETECTION_TILING_H
+#define PERCEPTION_INFERENCE_ENGINE_DETECTION_TILING_H
+
+#include "perception/datatypes/inference_engine_type.h"
+
+#include <opencv4/opencv2/core.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace perception
+{
+/// @brief Index of the detection classes output (N x 1), as provided by SSD models (TF Object Detection API layout)
+constexpr std::size_t kDetectionClassesIndex{0U};
+
+/// @brief Index of the detection scores output (N x 1)
+constexpr std::size_t kDetectionScoresIndex{1U};
+
+/// @brief Index of the detection boxes output (N x 4, [ymin, xmin, ymax, xmax] relative to the image size)
+constexpr std::size_t kDetectionBoxesIndex{2U};
+
+/// @brief Index of the number of detections output (1 x 1)
+constexpr std::size_t kNumDetectionsIndex{3U};
+
+/// @brief Check whether tiled execution is requested, i.e. more than one tile or a region of interest smaller than the
+/// frame
+///
+/// @param tiling_parameters [in] Tiling parameters
+///
+/// @return True if frames have to be tiled, otherwise False (frames are executed as a whole)
+bool IsTilingEnabled(const TilingParameters& tiling_parameters);
+
+/// @brief Provide tiles covering the region of interest of the frame
+///
+/// @param image_size [in] Frame size
+/// @param tiling_parameters [in] Tiling parameters
+///
+/// @return Tiles (of equal size, in row-major order) in frame coordinates
+std::vector<cv::Rect> GetTiles(const cv::Size& image_size, const TilingParameters& tiling_parameters);
+
+/// @brief Merge detections of all tiles to frame coordinates. Detections of the same class from overlapping tiles are
+/// merged by non-maximum suppression.
+///
+/// @param tile_results [in] Detection results for each tile (SSD layout, see kDetectionClassesIndex)
+/// @param tiles [in] Tiles in frame coordinates (same order as tile_results)
+/// @param image_size [in] Frame size
+/// @param merge_iou_threshold [in] Intersection over union above which detections are merged
+/// @param results [in/out] Merged detection results (SSD layout, relative to the frame size, sorted by score; buffers
+///                         reused as long as the maximum number of detections does not change)
+void MergeDetections(const std::vector<std::vector<cv::Mat>>& tile_results,
+                     const std::vector<cv::Rect>& tiles,
+                     const cv::Size& image_size,
+                     const float merge_iou_threshold,
+                     std::vector<cv::Mat>& results);
+}  // namespace perception
+#endif  /// PERCEPTION_INFERENCE_ENGINE_DETECTION_TILING_H
@@ -6,6 +6,8 @@
 #ifndef PERCEPTION_INFERENCE_ENGINE_I_INFERENCE_ENGINE_H
 #define PERCEPTION_INFERENCE_ENGINE_I_INFERENCE_ENGINE_H
 
+#include "perception/datatypes/inference_engine_type.h"
+
 #include <opencv4/opencv2/core.hpp>
 
 #include <cstdint>
@@ -33,14 +35,53 @@ class IInferenceEngine
     /// @param image [in] Image to be fed as input to Inference Engine
     virtual void Execute(const Image& image) = 0;
 
+    /// @brief Execute Inference with Inference Engine for a batch of images, stacked into a single batched input tensor
+    ///
+    /// @note Aborts for more than one image, if the model does not support batching (see IsBatchingSupported).
+    ///
+    /// @param images [in] Images (of same size and type) to be fed as input to Inference Engine
+    virtual void ExecuteBatch(const std::vector<Image>& images) = 0;
+
     /// @brief Release Inference Engine
     virtual void Shutdown() = 0;
 
     /// @brief Provide results in terms of Matrix
     ///
+    /// @note Provides results of the first image, if a batch of images has been executed.
+    /// @note Results are owned by the Inference Engine and provided without copying. Matrices are views on the engine's
+    ///       output tensors, hence they are only valid until the next call to Execute (or Shutdown). Clone the
+    ///       matrices, if they need to outlive it.
+    ///
     /// @return List of results (aka cv::Mat) for requested outputs (will be in same order as output_node_names provided
     ///         in InferenceEngineParameters)
-    virtual std::vector<cv::Mat> GetResults() const = 0;
+    virtual const std::vector<cv::Mat>& GetResults() const = 0;
+
+    /// @brief Provide results for each image of the last Execute/ExecuteBatch call (same lifetime as GetResults)
+    ///
+    /// @return List of results per image (will be in same order as images provided to ExecuteBatch)
+    virtual const std::vector<std::vector<cv::Mat>>& GetBatchResults() const = 0;
+
+    /// @brief Provide input tensor expected by the model, read from the model at Init (e.g. for upstream nodes to
+    /// provide images at network resolution, instead of full resolution images being downscaled)
+    ///
+    /// @return Input size, channels and element type
+    virtual const InputTensorInfo& GetInputTensorInfo() const = 0;
+
+    /// @brief Provide latencies measured while warming up the Inference Engine during Init
+    ///
+    /// @return Warm-up statistics (zero iterations, if warm-up is disabled)
+    virtual const WarmUpStatistics& GetWarmUpStatistics() const = 0;
+
+    /// @brief Provide latencies of the stages of the last Execute/ExecuteBatch call
+    ///
+    /// @return Stage latencies (zero, if not measured by the Inference Engine)
+    virtual const InferenceStageLatencies& GetStageLatencies() const = 0;
+
+    /// @brief Provide whether the model accepts more than one image per ExecuteBatch call, i.e. whether its input and
+    /// all the requested outputs have a batch dimension (determined at Init)
+    ///
+    /// @return True, if ExecuteBatch accepts more than one image
+    virtual bool IsBatchingSupported() const = 0;
 };
 
 /// @brief InferenceEngine unique instance pointer
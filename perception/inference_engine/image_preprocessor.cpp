@@ -0,0 +1,245 @@
+///
+/// @file
+/// @copyright Copyright (c) 2023. MIT License
+///
+#include "perception/inference_engine/image_preprocessor.h"
+
+#include "perception/common/logging.h"
+
+#include <opencv4/opencv2/core/hal/intrin.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace perception
+{
+namespace
+{
+/// @brief Provide source coordinate and weight of the next source pixel for the output coordinate (bilinear
+/// interpolation with pixel centers aligned, as cv::INTER_LINEAR)
+///
+/// @param index [in] Output coordinate
+/// @param source_length [in] Length of the source dimension
+/// @param length [in] Length of the output dimension
+/// @param source_index [out] Source coordinate (clamped to the source dimension)
+/// @param weight [out] Weight of the next source pixel
+void GetSourceCoordinate(const std::int32_t index,
+                         const std::int32_t source_length,
+                         const std::int32_t length,
+                         std::int32_t& source_index,
+                         float& weight)
+{
+    const auto scale = static_cast<float>(source_length) / static_cast<float>(length);
+    const auto coordinate = std::max(((static_cast<float>(index) + 0.5F) * scale) - 0.5F, 0.0F);
+    source_index = static_cast<std::int32_t>(std::floor(coordinate));
+    weight = coordinate - static_cast<float>(source_index);
+    if (source_index >= (source_length - 1))
+    {
+        source_index = source_length - 1;
+        weight = 0.0F;
+    }
+}
+
+/// @brief Vertically interpolate two rows and normalize them, i.e. (top + weight * (bottom - top)) * scale + offset,
+/// with OpenCV universal intrinsics (SSE/AVX on x86_64, NEON on aarch64) and a scalar tail
+///
+/// @param top [in] Top row
+/// @param bottom [in] Bottom row (may be top, for weight 0)
+/// @param weight [in] Weight of the bottom row
+/// @param scale [in] Scale applied to each interpolated value
+/// @param offset [in] Offset added to each scaled value
+/// @param length [in] Number of elements of each row
+/// @param output [out] Normalized row
+void BlendRows(const float* top,
+               const float* bottom,
+               const float weight,
+               const float scale,
+               const float offset,
+               const std::size_t length,
+               float* output)
+{
+    std::size_t index = 0U;
+#if CV_SIMD
+    const auto lanes = static_cast<std::size_t>(cv::v_float32::nlanes);
+    const auto weights = cv::vx_setall_f32(weight);
+    const auto scales = cv::vx_setall_f32(scale);
+    const auto offsets = cv::vx_setall_f32(offset);
+    for (; (index + lanes) <= length; index += lanes)
+    {
+        const auto top_values = cv::vx_load(top + index);
+        const auto values = cv::v_fma(weights, cv::vx_load(bottom + index) - top_values, top_values);
+        cv::v_store(output + index, cv::v_fma(values, scales, offsets));
+    }
+#endif
+    for (; index < length; ++index)
+    {
+        const auto value = top[index] + (weight * (bottom[index] - top[index]));
+        output[index] = (value * scale) + offset;
+    }
+}
+}  // namespace
+
+ImagePreprocessor::ImagePreprocessor(const TensorLayout layout, const bool swap_red_blue)
+    : layout_{layout},
+      swap_red_blue_{swap_red_blue},
+      image_size_{},
+      channels_{0},
+      size_{},
+      column_offsets_{},
+      column_weights_{},
+      row_indices_{},
+      row_weights_{},
+      top_row_{},
+      bottom_row_{},
+      values_{}
+{
+}
+
+void ImagePreprocessor::Preprocess(const Image& image,
+                                   const cv::Size& size,
+                                   const float scale,
+                                   const float offset,
+                                   float* output)
+{
+    PreprocessImage(image, size, scale, offset, output);
+}
+
+void ImagePreprocessor::Preprocess(const Image& image,
+                                   const cv::Size& size,
+                                   const float scale,
+                                   const float offset,
+                                   std::uint8_t* output)
+{
+    PreprocessImage(image, size, scale, offset, output);
+}
+
+void ImagePreprocessor::Preprocess(const Image& image,
+                                   const cv::Size& size,
+                                   const float scale,
+                                   const float offset,
+                                   std::int8_t* output)
+{
+    PreprocessImage(image, size, scale, offset, output);
+}
+
+template <typename T>
+void ImagePreprocessor::PreprocessImage(const Image& image,
+                                        const cv::Size& size,
+                                        const float scale,
+                                        const float offset,
+                                        T* output)
+{
+    CHECK_EQ(image.depth(), CV_8U) << "Preprocessing expects 8-bit image (received depth " << image.depth() << ")";
+    CHECK((image.channels() == 1) || (image.channels() == 3))
+        << "Preprocessing expects 1 or 3 channels (received " << image.channels() << ")";
+
+    UpdateInterpolationTables(image.size(), image.channels(), size);
+
+    const auto channels = static_cast<std::size_t>(channels_);
+    const auto width = static_cast<std::size_t>(size_.width);
+    const auto row_length = width * channels;
+    const auto plane_size = width * static_cast<std::size_t>(size_.height);
+    const auto swap = swap_red_blue_ && (channels == 3U);
+
+    for (std::int32_t row = 0; row < size_.height; ++row)
+    {
+        const auto row_index = static_cast<std::size_t>(row);
+        const auto row_weight = row_weights_[row_index];
+
+        // vertical interpolation and normalization, contiguous over the interleaved row (SIMD, see BlendRows)
+        InterpolateRow(image, row_indices_[2U * row_index], top_row_.data());
+        const float* bottom_row = top_row_.data();
+        if (row_weight > 0.0F)
+        {
+            InterpolateRow(image, row_indices_[(2U * row_index) + 1U], bottom_row_.data());
+            bottom_row = bottom_row_.data();
+        }
+        BlendRows(top_row_.data(), bottom_row, row_weight, scale, offset, row_length, values_.data());
+
+        // channel order and layout conversion while storing to the input tensor
+        for (std::size_t channel = 0U; channel < channels; ++channel)
+        {
+            const auto output_channel = swap ? (2U - channel) : channel;
+            if (layout_ == TensorLayout::kNCHW)
+            {
+                T* destination = output + (output_channel * plane_size) + (row_index * width);
+                for (std::size_t column = 0U; column < width; ++column)
+                {
+                    destination[column] = cv::saturate_cast<T>(values_[(column * channels) + channel]);
+                }
+            }
+            else
+            {
+                T* destination = output + (row_index * row_length) + output_channel;
+                for (std::size_t column = 0U; column < width; ++column)
+                {
+                    destination[column * channels] = cv::saturate_cast<T>(values_[(column * channels) + channel]);
+                }
+            }
+        }
+    }
+}
+
+void ImagePreprocessor::UpdateInterpolationTables(const cv::Size& image_size,
+                                                  const std::int32_t channels,
+                                                  const cv::Size& size)
+{
+    if ((image_size == image_size_) && (channels == channels_) && (size == size_))
+    {
+        return;
+    }
+    image_size_ = image_size;
+    channels_ = channels;
+    size_ = size;
+
+    const auto width = static_cast<std::size_t>(size.width);
+    const auto height = static_cast<std::size_t>(size.height);
+    column_offsets_.resize(2U * width);
+    column_weights_.resize(width);
+    for (std::size_t column = 0U; column < width; ++column)
+    {
+        std::int32_t source_column{0};
+        GetSourceCoordinate(
+            static_cast<std::int32_t>(column), image_size.width, size.width, source_column, column_weights_[column]);
+        column_offsets_[2U * column] = source_column * channels;
+        column_offsets_[(2U * column) + 1U] = std::min(source_column + 1, image_size.width - 1) * channels;
+    }
+
+    row_indices_.resize(2U * height);
+    row_weights_.resize(height);
+    for (std::size_t row = 0U; row < height; ++row)
+    {
+        std::int32_t source_row{0};
+        GetSourceCoordinate(
+            static_cast<std::int32_t>(row), image_size.height, size.height, source_row, row_weights_[row]);
+        row_indices_[2U * row] = source_row;
+        row_indices_[(2U * row) + 1U] = std::min(source_row + 1, image_size.height - 1);
+    }
+
+    const auto row_length = width * static_cast<std::size_t>(channels);
+    top_row_.resize(row_length);
+    bottom_row_.resize(row_length);
+    values_.resize(row_length);
+
+    LOG(INFO) << "Computed interpolation tables for " << image_size.height << "x" << image_size.width << "x" << channels
+              << " to " << size.height << "x" << size.width << " preprocessing.";
+}
+
+void ImagePreprocessor::InterpolateRow(const Image& image, const std::int32_t row, float* output) const
+{
+    const auto* source = image.ptr<std::uint8_t>(row);
+    const auto channels = static_cast<std::size_t>(channels_);
+    const auto width = static_cast<std::size_t>(size_.width);
+    for (std::size_t column = 0U; column < width; ++column)
+    {
+        const auto* left = source + column_offsets_[2U * column];
+        const auto* right = source + column_offsets_[(2U * column) + 1U];
+        const auto weight = column_weights_[column];
+        for (std::size_t channel = 0U; channel < channels; ++channel)
+        {
+            const auto value = static_cast<float>(left[channel]);
+            output[(column * channels) + channel] = value + (weight * (static_cast<float>(right[channel]) - value));
+        }
+    }
+}
+}  // namespace perception
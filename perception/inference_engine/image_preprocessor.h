@@ -0,0 +1,129 @@
+///
+/// @file
+/// @copyright Copyright (c) 2023. MIT License
+///
+#ifndef PERCEPTION_INFERENCE_ENGINE_IMAGE_PREPROCESSOR_H
+#define PERCEPTION_INFERENCE_ENGINE_IMAGE_PREPROCESSOR_H
+
+#include "perception/inference_engine/i_inference_engine.h"
+
+#include <opencv4/opencv2/core.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace perception
+{
+/// @brief Memory layout of the model input tensor
+enum class TensorLayout : std::uint8_t
+{
+    kNHWC = 0U,
+    kNCHW = 1U
+};
+
+/// @brief Converts images to the model input tensor in a single pass, i.e. bilinear resize, BGR to RGB conversion,
+/// normalization (pixel * scale + offset) and layout conversion are fused per output row and written directly to the
+/// input tensor without intermediate full-frame images.
+///
+/// @note Interpolation tables are computed once per (input, output) geometry and reused for further images.
+class ImagePreprocessor final
+{
+  public:
+    /// @brief Constructor
+    ///
+    /// @param layout [in] Memory layout of the model input tensor
+    /// @param swap_red_blue [in] Swap first and third channel (i.e. BGR to RGB) of 3-channel images
+    ImagePreprocessor(const TensorLayout layout, const bool swap_red_blue);
+
+    /// @brief Preprocess image and write it to the (float) model input tensor
+    ///
+    /// @param image [in] Image to be preprocessed (8-bit, 1 or 3 channels)
+    /// @param size [in] Model input size
+    /// @param scale [in] Scale applied to each resized pixel (e.g. 1 / stddev)
+    /// @param offset [in] Offset added to each scaled pixel (e.g. -mean / stddev)
+    /// @param output [out] Model input tensor (size.height x size.width x channels elements)
+    void Preprocess(const Image& image, const cv::Size& size, const float scale, const float offset, float* output);
+
+    /// @brief Preprocess image and write it to the (uint8) model input tensor, rounded and saturated
+    ///
+    /// @param image [in] Image to be preprocessed (8-bit, 1 or 3 channels)
+    /// @param size [in] Model input size
+    /// @param scale [in] Scale applied to each resized pixel (e.g. 1 / (stddev * quantization scale))
+    /// @param offset [in] Offset added to each scaled pixel (e.g. zero point - mean * scale)
+    /// @param output [out] Model input tensor (size.height x size.width x channels elements)
+    void Preprocess(const Image& image,
+                    const cv::Size& size,
+                    const float scale,
+                    const float offset,
+                    std::uint8_t* output);
+
+    /// @brief Preprocess image and write it to the (int8) model input tensor, rounded and saturated
+    ///
+    /// @param image [in] Image to be preprocessed (8-bit, 1 or 3 channels)
+    /// @param size [in] Model input size
+    /// @param scale [in] Scale applied to each resized pixel (e.g. 1 / (stddev * quantization scale))
+    /// @param offset [in] Offset added to each scaled pixel (e.g. zero point - mean * scale)
+    /// @param output [out] Model input tensor (size.height x size.width x channels elements)
+    void Preprocess(const Image& image,
+                    const cv::Size& size,
+                    const float scale,
+                    const float offset,
+                    std::int8_t* output);
+
+  private:
+    /// @brief Fused preprocessing for the element type of the model input tensor
+    template <typename T>
+    void PreprocessImage(const Image& image, const cv::Size& size, const float scale, const float offset, T* output);
+
+    /// @brief Recompute interpolation tables, if image or model input geometry has changed
+    ///
+    /// @param image_size [in] Size of the input image
+    /// @param channels [in] Channels of the input image
+    /// @param size [in] Model input size
+    void UpdateInterpolationTables(const cv::Size& image_size, const std::int32_t channels, const cv::Size& size);
+
+    /// @brief Horizontally interpolate image row to the model input width
+    ///
+    /// @param image [in] Input image
+    /// @param row [in] Row of the input image
+    /// @param output [out] Interpolated row (size.width x channels elements)
+    void InterpolateRow(const Image& image, const std::int32_t row, float* output) const;
+
+    /// @brief Memory layout of the model input tensor
+    TensorLayout layout_;
+
+    /// @brief Swap first and third channel of 3-channel images
+    bool swap_red_blue_;
+
+    /// @brief Input image size of the interpolation tables
+    cv::Size image_size_;
+
+    /// @brief Input image channels of the interpolation tables
+    std::int32_t channels_;
+
+    /// @brief Model input size of the interpolation tables
+    cv::Size size_;
+
+    /// @brief Byte offsets of the left and right source pixel, for each output column
+    std::vector<std::int32_t> column_offsets_;
+
+    /// @brief Weight of the right source pixel, for each output column
+    std::vector<float> column_weights_;
+
+    /// @brief Top and bottom source row, for each output row
+    std::vector<std::int32_t> row_indices_;
+
+    /// @brief Weight of the bottom source row, for each output row
+    std::vector<float> row_weights_;
+
+    /// @brief Top source row, interpolated to the model input width
+    std::vector<float> top_row_;
+
+    /// @brief Bottom source row, interpolated to the model input width
+    std::vector<float> bottom_row_;
+
+    /// @brief Normalized output row (interleaved channels)
+    std::vector<float> values_;
+};
+}  // namespace perception
+#endif  /// PERCEPTION_INFERENCE_ENGINE_IMAGE_PREPROCESSOR_H
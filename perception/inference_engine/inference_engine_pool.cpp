@@ -0,0 +1,197 @@
+///
+/// @file
+/// @copyright Copyright (c) 2023. MIT License
+///
+#include "perception/inference_engine/inference_engine_pool.h"
+
+#include "perception/common/logging.h"
+#include "perception/inference_engine/null_inference_engine.h"
+#include "perception/inference_engine/onnxruntime_inference_engine.h"
+#include "perception/inference_engine/opencv_inference_engine.h"
+#include "perception/inference_engine/tf_inference_engine.h"
+#include "perception/inference_engine/tflite_inference_engine.h"
+#include "perception/inference_engine/torch_inference_engine.h"
+
+#include <algorithm>
+#include <thread>
+#include <tuple>
+
+namespace perception
+{
+namespace
+{
+InferenceEnginePtr CreateInferenceEngine(const InferenceEngineType& inference_engine_type,
+                                         const InferenceEngineParameters& inference_engine_parameters)
+{
+    switch (inference_engine_type)
+    {
+        case InferenceEngineType::kTensorFlow:
+        {
+            return std::make_unique<TFInferenceEngine>(inference_engine_parameters);
+        }
+        case InferenceEngineType::kTensorFlowLite:
+        {
+            return std::make_unique<TFLiteInferenceEngine>(inference_engine_parameters);
+        }
+        case InferenceEngineType::kTorch:
+        {
+            return std::make_unique<TorchInferenceEngine>(inference_engine_parameters);
+        }
+        case InferenceEngineType::kOpenCV:
+        {
+            return std::make_unique<OpenCVInferenceEngine>(inference_engine_parameters);
+        }
+        case InferenceEngineType::kOnnxRuntime:
+        {
+            return std::make_unique<OnnxRuntimeInferenceEngine>(inference_engine_parameters);
+        }
+        case InferenceEngineType::kInvalid:
+        default:
+        {
+            LOG(FATAL) << "Received " << inference_engine_type;
+            return std::make_unique<NullInferenceEngine>(inference_engine_parameters);
+        }
+    }
+}
+}  // namespace
+
+bool InferenceEnginePool::ModelKey::operator<(const ModelKey& other) const
+{
+    const auto tie = [](const ModelKey& key) {
+        const auto& params = key.parameters;
+        return std::tie(key.type,
+                        params.model_path,
+                        params.input_tensor_name,
+                        params.output_tensor_names,
+                        params.config_path,
+                        params.swap_red_blue,
+                        params.input_size.width,
+                        params.input_size.height,
+                        params.input_scale,
+                        params.input_offset,
+                        params.cpu_affinity_mask,
+                        params.graph_optimization,
+                        params.xla_jit,
+                        params.xnnpack_delegate,
+                        params.warm_up_iterations);
+    };
+    return tie(*this) < tie(other);
+}
+
+constexpr std::int32_t InferenceEnginePool::kDefaultInterOpThreads;
+constexpr std::int32_t InferenceEnginePool::kDefaultThreadsShare;
+
+InferenceEnginePool& InferenceEnginePool::GetInstance()
+{
+    // intentionally leaked, so that it outlives all the execution contexts (i.e. including static ones)
+    static auto* instance = new InferenceEnginePool{
+        std::max(static_cast<std::int32_t>(std::thread::hardware_concurrency()), 1),
+        kDefaultInterOpThreads,
+        CreateInferenceEngine};
+    return *instance;
+}
+
+InferenceEnginePool::InferenceEnginePool(const std::int32_t max_intra_op_threads,
+                                         const std::int32_t max_inter_op_threads,
+                                         InferenceEngineFactory factory)
+    : max_intra_op_threads_{max_intra_op_threads},
+      max_inter_op_threads_{max_inter_op_threads},
+      factory_{std::move(factory)},
+      allocated_intra_op_threads_{0},
+      allocated_inter_op_threads_{0},
+      models_{},
+      mutex_{}
+{
+    CHECK(max_intra_op_threads_ > 0) << "Received invalid intra-op threads budget " << max_intra_op_threads_;
+    CHECK(max_inter_op_threads_ > 0) << "Received invalid inter-op threads budget " << max_inter_op_threads_;
+    CHECK(factory_) << "Received invalid inference engine factory.";
+}
+
+InferenceEnginePtr InferenceEnginePool::Acquire(const InferenceEngineType& inference_engine_type,
+                                                const InferenceEngineParameters& inference_engine_parameters)
+{
+    std::lock_guard<std::mutex> lock{mutex_};
+
+    // models loaded with different settings are not interchangeable (e.g. results are provided in order of the output
+    // names, images are preprocessed for the input size and scale of the first request)
+    const ModelKey key{inference_engine_type, inference_engine_parameters};
+    auto model = models_[key].lock();
+    if (model)
+    {
+        return std::make_unique<SharedInferenceEngine>(std::move(model));
+    }
+
+    auto params = inference_engine_parameters;
+    params.intra_op_threads =
+        GrantThreads(params.intra_op_threads, max_intra_op_threads_, allocated_intra_op_threads_);
+    params.inter_op_threads =
+        GrantThreads(params.inter_op_threads, max_inter_op_threads_, allocated_inter_op_threads_);
+
+    const auto intra_op_threads = params.intra_op_threads;
+    const auto inter_op_threads = params.inter_op_threads;
+    auto engine = factory_(inference_engine_type, params);
+    model.reset(new SharedModel{}, [this, key, intra_op_threads, inter_op_threads](SharedModel* shared_model) {
+        Release(key, intra_op_threads, inter_op_threads);
+        delete shared_model;
+    });
+    model->engine = std::move(engine);
+    models_[key] = model;
+
+    LOG(INFO) << "Loaded " << inference_engine_type << " model '" << key.parameters.model_path
+              << "' (intra-op threads: " << intra_op_threads << ", inter-op threads: " << inter_op_threads << ").";
+
+    return std::make_unique<SharedInferenceEngine>(std::move(model));
+}
+
+std::size_t InferenceEnginePool::GetNumberOfLoadedModels() const
+{
+    std::lock_guard<std::mutex> lock{mutex_};
+    return static_cast<std::size_t>(std::count_if(
+        models_.cbegin(), models_.cend(), [](const auto& entry) { return !entry.second.expired(); }));
+}
+
+std::int32_t InferenceEnginePool::GetAvailableIntraOpThreads() const
+{
+    std::lock_guard<std::mutex> lock{mutex_};
+    return std::max(max_intra_op_threads_ - allocated_intra_op_threads_, 0);
+}
+
+std::int32_t InferenceEnginePool::GetAvailableInterOpThreads() const
+{
+    std::lock_guard<std::mutex> lock{mutex_};
+    return std::max(max_inter_op_threads_ - allocated_inter_op_threads_, 0);
+}
+
+std::int32_t InferenceEnginePool::GrantThreads(const std::int32_t requested_threads,
+                                               const std::int32_t max_threads,
+                                               std::int32_t& allocated_threads)
+{
+    const auto available_threads = std::max(max_threads - allocated_threads, 0);
+    const auto default_threads = std::max(max_threads / kDefaultThreadsShare, 1);
+    auto granted_threads = std::min((requested_threads > 0) ? requested_threads : default_threads, available_threads);
+    if (granted_threads < 1)
+    {
+        LOG(WARNING) << "Thread budget of " << max_threads << " exhausted, granting a single thread.";
+        granted_threads = 1;
+    }
+    allocated_threads += granted_threads;
+    return granted_threads;
+}
+
+void InferenceEnginePool::Release(const ModelKey& key,
+                                  const std::int32_t intra_op_threads,
+                                  const std::int32_t inter_op_threads)
+{
+    std::lock_guard<std::mutex> lock{mutex_};
+
+    // entry might already refer to a reloaded model
+    const auto it = models_.find(key);
+    if ((it != models_.end()) && it->second.expired())
+    {
+        models_.erase(it);
+    }
+    allocated_intra_op_threads_ -= intra_op_threads;
+    allocated_inter_op_threads_ -= inter_op_threads;
+}
+
+}  // namespace perception
@@ -0,0 +1,143 @@
+///
+/// @file
+/// @copyright Copyright (c) 2023. MIT License
+///
+#ifndef PERCEPTION_INFERENCE_ENGINE_INFERENCE_ENGINE_POOL_H
+#define PERCEPTION_INFERENCE_ENGINE_INFERENCE_ENGINE_POOL_H
+
+#include "perception/datatypes/inference_engine_type.h"
+#include "perception/inference_engine/i_inference_engine.h"
+#include "perception/inference_engine/shared_inference_engine.h"
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace perception
+{
+/// @brief Process-wide pool of loaded models. Models are deduplicated by type and all the parameters but the threads
+/// (see ModelKey), i.e. nodes requesting the same model with the same settings share a single loaded instance and get
+/// their own execution context (see SharedInferenceEngine).
+///
+/// Intra-op and inter-op threads are granted to each loaded model out of a common budget, so that the sum of all the
+/// backend thread pools does not oversubscribe the cores. Unspecified requests (0 threads) are granted a share of the
+/// budget, instead of the backend default (i.e. all the cores). Threads are returned to the budget once the last
+/// execution context of a model is released.
+///
+/// @note Threads requested by the first request of a model are used for loading it.
+class InferenceEnginePool final
+{
+  public:
+    /// @brief Creates (not initialised) Inference Engine of given type
+    using InferenceEngineFactory =
+        std::function<InferenceEnginePtr(const InferenceEngineType&, const InferenceEngineParameters&)>;
+
+    /// @brief Default budget of inter-op threads (independent operations run in parallel)
+    static constexpr std::int32_t kDefaultInterOpThreads{2};
+
+    /// @brief Unspecified requests (0 threads) are granted 1/kDefaultThreadsShare of the budget
+    static constexpr std::int32_t kDefaultThreadsShare{2};
+
+    /// @brief Provide process-wide pool (budget: hardware concurrency intra-op, kDefaultInterOpThreads inter-op)
+    ///
+    /// @return Inference Engine Pool
+    static InferenceEnginePool& GetInstance();
+
+    /// @brief Constructor
+    ///
+    /// @param max_intra_op_threads [in] Total number of intra-op threads shared by all the loaded models
+    /// @param max_inter_op_threads [in] Total number of inter-op threads shared by all the loaded models
+    /// @param factory [in] Creates Inference Engine for models which are not loaded yet
+    InferenceEnginePool(const std::int32_t max_intra_op_threads,
+                        const std::int32_t max_inter_op_threads,
+                        InferenceEngineFactory factory);
+
+    /// @brief Provide execution context of the requested model (loaded model is reused, if available)
+    ///
+    /// @param inference_engine_type [in] Inference Engine type
+    /// @param inference_engine_parameters [in] Inference Engine parameters (model path and requested threads)
+    ///
+    /// @return Execution context, to be initialised by the caller
+    InferenceEnginePtr Acquire(const InferenceEngineType& inference_engine_type,
+                               const InferenceEngineParameters& inference_engine_parameters);
+
+    /// @brief Provide number of models, currently used by at least one execution context
+    ///
+    /// @return Number of loaded models
+    std::size_t GetNumberOfLoadedModels() const;
+
+    /// @brief Provide number of intra-op threads, not granted to any loaded model
+    ///
+    /// @return Available intra-op threads
+    std::int32_t GetAvailableIntraOpThreads() const;
+
+    /// @brief Provide number of inter-op threads, not granted to any loaded model
+    ///
+    /// @return Available inter-op threads
+    std::int32_t GetAvailableInterOpThreads() const;
+
+  private:
+    /// @brief Model identifier, i.e. type and all the parameters the model is loaded and executed with (e.g. input
+    /// size, preprocessing, graph optimization), except for the requested threads
+    struct ModelKey
+    {
+        /// @brief Compare all the identifying members (ordering of models_)
+        ///
+        /// @param other [in] Model identifier to compare with
+        ///
+        /// @return True, if this identifier is ordered before other
+        bool operator<(const ModelKey& other) const;
+
+        /// @brief Inference Engine type
+        InferenceEngineType type;
+
+        /// @brief Inference Engine parameters (threads are not compared)
+        InferenceEngineParameters parameters;
+    };
+
+    /// @brief Grant threads out of the budget (at least one thread, even if budget is exhausted)
+    ///
+    /// @param requested_threads [in] Requested threads (0: unspecified, i.e. 1/kDefaultThreadsShare of budget)
+    /// @param max_threads [in] Budget
+    /// @param allocated_threads [in/out] Threads granted so far
+    ///
+    /// @return Granted threads
+    static std::int32_t GrantThreads(const std::int32_t requested_threads,
+                                     const std::int32_t max_threads,
+                                     std::int32_t& allocated_threads);
+
+    /// @brief Release loaded model and return its threads to the budget
+    ///
+    /// @param key [in] Model identifier
+    /// @param intra_op_threads [in] Intra-op threads granted to the model
+    /// @param inter_op_threads [in] Inter-op threads granted to the model
+    void Release(const ModelKey& key, const std::int32_t intra_op_threads, const std::int32_t inter_op_threads);
+
+    /// @brief Total number of intra-op threads
+    const std::int32_t max_intra_op_threads_;
+
+    /// @brief Total number of inter-op threads
+    const std::int32_t max_inter_op_threads_;
+
+    /// @brief Creates Inference Engines for new models
+    const InferenceEngineFactory factory_;
+
+    /// @brief Intra-op threads granted to loaded models
+    std::int32_t allocated_intra_op_threads_;
+
+    /// @brief Inter-op threads granted to loaded models
+    std::int32_t allocated_inter_op_threads_;
+
+    /// @brief Loaded models (owned by their execution contexts)
+    std::map<ModelKey, std::weak_ptr<SharedModel>> models_;
+
+    /// @brief Guards models_ and thread budget
+    mutable std::mutex mutex_;
+};
+}  // namespace perception
+#endif  /// PERCEPTION_INFERENCE_ENGINE_INFERENCE_ENGINE_POOL_H
@@ -5,41 +5,47 @@
 #include "perception/inference_engine/inference_engine_strategy.h"
 
 #include "perception/common/logging.h"
+#include "perception/inference_engine/detection_tiling.h"
+#include "perception/inference_engine/inference_engine_pool.h"
 #include "perception/inference_engine/null_inference_engine.h"
-#include "perception/inference_engine/opencv_inference_engine.h"
-#include "perception/inference_engine/tf_inference_engine.h"
-#include "perception/inference_engine/tflite_inference_engine.h"
-#include "perception/inference_engine/torch_inference_engine.h"
+
+#include <algorithm>
 
 namespace perception
 {
 
-InferenceEngineStrategy::InferenceEngineStrategy() : inference_engine_type_{InferenceEngineType::kInvalid} {}
+InferenceEngineStrategy::InferenceEngineStrategy()
+    : inference_engine_{},
+      async_inference_engine_{},
+      inference_engine_type_{InferenceEngineType::kInvalid},
+      tiling_parameters_{},
+      tiles_image_size_{},
+      tiles_{},
+      tile_images_{},
+      tile_results_{},
+      tiled_results_{},
+      tiled_{false}
+{
+}
 
 void InferenceEngineStrategy::SelectInferenceEngine(const InferenceEngineType& inference_engine_type,
                                                     const InferenceEngineParameters& inference_engine_parameters)
 {
+    // asynchronous execution refers to the previously selected Inference Engine
+    ReleaseAsyncInferenceEngine();
+
     inference_engine_type_ = inference_engine_type;
     switch (inference_engine_type)
     {
         case InferenceEngineType::kTensorFlow:
-        {
-            inference_engine_ = std::make_unique<TFInferenceEngine>(inference_engine_parameters);
-            break;
-        }
         case InferenceEngineType::kTensorFlowLite:
-        {
-            inference_engine_ = std::make_unique<TFLiteInferenceEngine>(inference_engine_parameters);
-            break;
-        }
         case InferenceEngineType::kTorch:
-        {
-            inference_engine_ = std::make_unique<TorchInferenceEngine>(inference_engine_parameters);
-            break;
-        }
         case InferenceEngineType::kOpenCV:
+        case InferenceEngineType::kOnnxRuntime:
         {
-            inference_engine_ = std::make_unique<OpenCVInferenceEngine>(inference_engine_parameters);
+            // loaded models are shared between all the strategies requesting the same model
+            inference_engine_ =
+                InferenceEnginePool::GetInstance().Acquire(inference_engine_type, inference_engine_parameters);
             break;
         }
         case InferenceEngineType::kInvalid:
@@ -59,21 +65,140 @@ void InferenceEngineStrategy::Init()
 
 void InferenceEngineStrategy::Execute(const Image& image)
 {
-    inference_engine_->Execute(image);
+    WaitForSubmittedFrames();
+    tiled_ = IsTilingEnabled(tiling_parameters_);
+    if (tiled_)
+    {
+        ExecuteTiled(image);
+    }
+    else
+    {
+        inference_engine_->Execute(image);
+    }
+}
+
+std::future<const std::vector<cv::Mat>&> InferenceEngineStrategy::Submit(const Image& image)
+{
+    CHECK(!IsTilingEnabled(tiling_parameters_)) << "Tiled execution is not supported for asynchronous inference.";
+    if (async_inference_engine_ == nullptr)
+    {
+        async_inference_engine_ = std::make_unique<AsyncInferenceEngine>(*inference_engine_);
+        async_inference_engine_->Init();
+    }
+    return async_inference_engine_->Submit(image);
+}
+
+void InferenceEngineStrategy::ExecuteBatch(const std::vector<Image>& images)
+{
+    WaitForSubmittedFrames();
+    tiled_ = false;
+    inference_engine_->ExecuteBatch(images);
+}
+
+void InferenceEngineStrategy::SetTilingParameters(const TilingParameters& tiling_parameters)
+{
+    tiling_parameters_ = tiling_parameters;
+
+    // recompute tiles on next Execute
+    tiles_image_size_ = cv::Size{};
 }
 
 void InferenceEngineStrategy::Shutdown()
 {
+    ReleaseAsyncInferenceEngine();
     inference_engine_->Shutdown();
 }
 
-std::vector<cv::Mat> InferenceEngineStrategy::GetResults() const
+const std::vector<cv::Mat>& InferenceEngineStrategy::GetResults() const
 {
-    return inference_engine_->GetResults();
+    return tiled_ ? tiled_results_ : inference_engine_->GetResults();
+}
+
+const std::vector<std::vector<cv::Mat>>& InferenceEngineStrategy::GetBatchResults() const
+{
+    return inference_engine_->GetBatchResults();
+}
+
+const InputTensorInfo& InferenceEngineStrategy::GetInputTensorInfo() const
+{
+    return inference_engine_->GetInputTensorInfo();
+}
+
+const WarmUpStatistics& InferenceEngineStrategy::GetWarmUpStatistics() const
+{
+    return inference_engine_->GetWarmUpStatistics();
+}
+
+const InferenceStageLatencies& InferenceEngineStrategy::GetStageLatencies() const
+{
+    return inference_engine_->GetStageLatencies();
 }
 
 InferenceEngineType InferenceEngineStrategy::GetInferenceEngineType() const
 {
     return inference_engine_type_;
 }
+
+void InferenceEngineStrategy::WaitForSubmittedFrames()
+{
+    if (async_inference_engine_ != nullptr)
+    {
+        async_inference_engine_->Wait();
+    }
+}
+
+void InferenceEngineStrategy::ReleaseAsyncInferenceEngine()
+{
+    if (async_inference_engine_ != nullptr)
+    {
+        async_inference_engine_->Shutdown();
+        async_inference_engine_.reset();
+    }
+}
+
+void InferenceEngineStrategy::ExecuteTiled(const Image& image)
+{
+    if (image.size() != tiles_image_size_)
+    {
+        tiles_ = GetTiles(image.size(), tiling_parameters_);
+        tiles_image_size_ = image.size();
+        LOG(INFO) << "Executing " << tiles_.size() << " tiles of " << tiles_.front().width << "x"
+                  << tiles_.front().height << " for " << image.cols << "x" << image.rows << " images.";
+    }
+
+    tile_images_.resize(tiles_.size());
+    std::transform(
+        tiles_.cbegin(), tiles_.cend(), tile_images_.begin(), [&image](const auto& tile) { return image(tile); });
+
+    if (inference_engine_->IsBatchingSupported())
+    {
+        inference_engine_->ExecuteBatch(tile_images_);
+        MergeDetections(inference_engine_->GetBatchResults(),
+                        tiles_,
+                        image.size(),
+                        tiling_parameters_.merge_iou_threshold,
+                        tiled_results_);
+        return;
+    }
+
+    // results are views on the engine's output tensors, hence copied before the next tile is executed
+    tile_results_.resize(tile_images_.size());
+    for (std::size_t index = 0U; index < tile_images_.size(); ++index)
+    {
+        inference_engine_->Execute(tile_images_.at(index));
+        const auto& results = inference_engine_->GetResults();
+        auto& tile_results = tile_results_.at(index);
+        tile_results.resize(results.size());
+        for (std::size_t output = 0U; output < results.size(); ++output)
+        {
+            // reallocates only if output shape/type changes
+            results.at(output).copyTo(tile_results.at(output));
+        }
+    }
+    MergeDetections(tile_results_,
+                    tiles_,
+                    image.size(),
+                    tiling_parameters_.merge_iou_threshold,
+                    tiled_results_);
+}
 }  // namespace perception
@@ -6,9 +6,12 @@
 #define PERCEPTION_INFERENCE_ENGINE_INFERENCE_ENGINE_STRATEGY_H
 
 #include "perception/datatypes/inference_engine_type.h"
+#include "perception/inference_engine/async_inference_engine.h"
 #include "perception/inference_engine/i_inference_engine.h"
 
+#include <future>
 #include <memory>
+#include <vector>
 
 namespace perception
 {
@@ -25,10 +28,32 @@ class InferenceEngineStrategy final
 
     /// @brief Execute Inference with Inference Engine
     ///
+    /// @note If tiling is enabled (see SetTilingParameters), tiles of the image are executed as a single batch (one by
+    ///       one, if the model does not support batching) and their detections are merged to image coordinates.
+    ///
+    /// @note Waits for frames submitted for asynchronous inference (see Submit) to be completed first.
+    ///
     /// @param image [in] Image to be fed as input to Inference Engine
     void Execute(const Image& image);
 
-    /// @brief Release Inference Engine
+    /// @brief Submit image for asynchronous inference, i.e. the model runs on a worker thread while the caller
+    /// continues (e.g. with the next frame's resize, which is done on the caller's thread, see AsyncInferenceEngine)
+    ///
+    /// @note Tiled execution is not supported asynchronously.
+    ///
+    /// @param image [in] Image to be fed as input to Inference Engine
+    ///
+    /// @return Future providing the results of the image (valid until the frame after the next one is submitted)
+    std::future<const std::vector<cv::Mat>&> Submit(const Image& image);
+
+    /// @brief Execute Inference with Inference Engine for a batch of images
+    ///
+    /// @note Waits for frames submitted for asynchronous inference (see Submit) to be completed first.
+    ///
+    /// @param images [in] Images (of same size and type) to be fed as input to Inference Engine
+    void ExecuteBatch(const std::vector<Image>& images);
+
+    /// @brief Release Inference Engine (after completing frames submitted for asynchronous inference)
     void Shutdown();
 
     /// @brief Select Inference Engine
@@ -37,10 +62,38 @@ class InferenceEngineStrategy final
     void SelectInferenceEngine(const InferenceEngineType& inference_engine_type,
                                const InferenceEngineParameters& inference_engine_parameters);
 
-    /// @brief Provide results from Inference Engine
+    /// @brief Select tiled execution mode for Execute, i.e. overlapping tiles of a region of interest (e.g. horizon
+    /// band) are fed at model resolution, so that small (distant) objects are not lost by downscaling the whole image
+    ///
+    /// @note Requires detection outputs (classes, scores, boxes, num_detections, see kDetectionClassesIndex).
+    ///
+    /// @param tiling_parameters [in] Tiling parameters (default: whole image, no tiling)
+    void SetTilingParameters(const TilingParameters& tiling_parameters);
+
+    /// @brief Provide results from Inference Engine (without copying, valid until next call to Execute)
+    ///
+    /// @return Resultant Matries (list of matrix), merged detections in image coordinates for tiled execution
+    const std::vector<cv::Mat>& GetResults() const;
+
+    /// @brief Provide results for each image of the last executed batch
+    ///
+    /// @return Resultant Matries (list of matrix) per image (per tile, for tiled execution)
+    const std::vector<std::vector<cv::Mat>>& GetBatchResults() const;
+
+    /// @brief Provide input tensor expected by the model (read at Init)
     ///
-    /// @return Resultant Matries (list of matrix)
-    std::vector<cv::Mat> GetResults() const;
+    /// @return Input size, channels and element type
+    const InputTensorInfo& GetInputTensorInfo() const;
+
+    /// @brief Provide latencies measured while warming up the Inference Engine during Init
+    ///
+    /// @return Warm-up statistics
+    const WarmUpStatistics& GetWarmUpStatistics() const;
+
+    /// @brief Provide latencies of the stages of the last Execute/ExecuteBatch call
+    ///
+    /// @return Stage latencies
+    const InferenceStageLatencies& GetStageLatencies() const;
 
     /// @brief Provide selected inference engine type
     ///
@@ -48,11 +101,47 @@ class InferenceEngineStrategy final
     InferenceEngineType GetInferenceEngineType() const;
 
   private:
+    /// @brief Execute Inference for the tiles of the image and merge their detections
+    ///
+    /// @param image [in] Image to be fed as input to Inference Engine
+    void ExecuteTiled(const Image& image);
+
+    /// @brief Wait until frames submitted for asynchronous inference are completed, so that the Inference Engine can
+    /// be executed synchronously
+    void WaitForSubmittedFrames();
+
+    /// @brief Complete frames submitted for asynchronous inference and stop its worker thread
+    void ReleaseAsyncInferenceEngine();
+
     /// @brief Inference Engine
     std::unique_ptr<IInferenceEngine> inference_engine_;
 
+    /// @brief Asynchronous execution of inference_engine_ (created by the first Submit)
+    std::unique_ptr<AsyncInferenceEngine> async_inference_engine_;
+
     /// @brief Inference Engine Type
     InferenceEngineType inference_engine_type_;
+
+    /// @brief Tiling parameters
+    TilingParameters tiling_parameters_;
+
+    /// @brief Image size for which tiles_ have been computed
+    cv::Size tiles_image_size_;
+
+    /// @brief Tiles of the image (in image coordinates)
+    std::vector<cv::Rect> tiles_;
+
+    /// @brief Tiles of the last image (views on the image, no copy)
+    std::vector<Image> tile_images_;
+
+    /// @brief Results of each tile, for engines executing the tiles one by one (i.e. models not supporting batching)
+    std::vector<std::vector<cv::Mat>> tile_results_;
+
+    /// @brief Detections of all tiles, merged to image coordinates
+    std::vector<cv::Mat> tiled_results_;
+
+    /// @brief Last Execute has been tiled (i.e. results are provided by tiled_results_)
+    bool tiled_;
 };
 }  // namespace perception
 #endif  /// PERCEPTION_INFERENCE_ENGINE_INFERENCE_ENGINE_STRATEGY_H
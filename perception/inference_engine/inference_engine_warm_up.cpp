@@ -0,0 +1,82 @@
+///
+/// @file
+/// @copyright Copyright (c) 2023. MIT License
+///
+#include "perception/inference_engine/inference_engine_warm_up.h"
+
+#include "perception/common/logging.h"
+
+#include <chrono>
+
+namespace perception
+{
+namespace
+{
+/// @brief Run synthetic inferences with random images of given geometry
+///
+/// @param inference_engine [in/out] Initialised Inference Engine
+/// @param input_size [in] Size of the synthetic images
+/// @param channels [in] Channels of the synthetic images
+/// @param iterations [in] Number of warm-up inferences (0: no warm-up)
+///
+/// @return Measured cold (first) and warm (subsequent) latencies
+WarmUpStatistics RunWarmUp(IInferenceEngine& inference_engine,
+                           const cv::Size& input_size,
+                           const std::int32_t channels,
+                           const std::int32_t iterations)
+{
+    WarmUpStatistics statistics{};
+    if (iterations <= 0)
+    {
+        return statistics;
+    }
+
+    // random contents, so that data dependent paths (e.g. number of detections) are exercised as well
+    Image image{input_size, CV_8UC(channels)};
+    cv::randu(image, cv::Scalar::all(0), cv::Scalar::all(255));
+
+    std::chrono::microseconds total_warm_latency{0};
+    for (std::int32_t iteration = 0; iteration < iterations; ++iteration)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        inference_engine.Execute(image);
+        const auto latency =
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+        if (iteration == 0)
+        {
+            statistics.cold_latency = latency;
+        }
+        else
+        {
+            total_warm_latency += latency;
+        }
+    }
+    statistics.iterations = iterations;
+    statistics.warm_latency = (iterations > 1) ? (total_warm_latency / (iterations - 1))
+                                               : std::chrono::microseconds{0};
+
+    LOG(INFO) << "Warmed up with " << iterations << " inferences of " << input_size.width << "x" << input_size.height
+              << " images (cold latency: " << statistics.cold_latency.count()
+              << "us, warm latency: " << statistics.warm_latency.count() << "us).";
+
+    return statistics;
+}
+}  // namespace
+
+WarmUpStatistics WarmUp(IInferenceEngine& inference_engine,
+                        const cv::Size& input_size,
+                        const std::int32_t iterations)
+{
+    return RunWarmUp(inference_engine, input_size, 3, iterations);
+}
+
+WarmUpStatistics WarmUp(IInferenceEngine& inference_engine,
+                        const InputTensorInfo& input_tensor_info,
+                        const std::int32_t iterations)
+{
+    const auto input_size = input_tensor_info.size.empty() ? kDefaultWarmUpInputSize : input_tensor_info.size;
+    return RunWarmUp(inference_engine, input_size, input_tensor_info.channels, iterations);
+}
+
+}  // namespace perception
@@ -0,0 +1,44 @@
+///
+/// @file
+/// @copyright Copyright (c) 2023. MIT License
+///
+#ifndef PERCEPTION_INFERENCE_ENGINE_INFERENCE_ENGINE_WARM_UP_H
+#define PERCEPTION_INFERENCE_ENGINE_INFERENCE_ENGINE_WARM_UP_H
+
+#include "perception/datatypes/inference_engine_type.h"
+#include "perception/inference_engine/i_inference_engine.h"
+
+#include <opencv4/opencv2/core.hpp>
+
+#include <cstdint>
+
+namespace perception
+{
+/// @brief Input size used for warming up models without static input shape
+const cv::Size kDefaultWarmUpInputSize{300, 300};
+
+/// @brief Run synthetic inferences on the Inference Engine, so that lazy allocations, graph optimizations and JIT
+/// compilation happen ahead of the first real frame.
+///
+/// @param inference_engine [in/out] Initialised Inference Engine
+/// @param input_size [in] Input size declared by the model (3-channel images)
+/// @param iterations [in] Number of warm-up inferences (0: no warm-up)
+///
+/// @return Measured cold (first) and warm (subsequent) latencies
+WarmUpStatistics WarmUp(IInferenceEngine& inference_engine,
+                        const cv::Size& input_size,
+                        const std::int32_t iterations);
+
+/// @brief Run synthetic inferences on the Inference Engine at the size and channels of its input tensor
+///
+/// @param inference_engine [in/out] Initialised Inference Engine
+/// @param input_tensor_info [in] Input tensor expected by the model (kDefaultWarmUpInputSize, if dynamic)
+/// @param iterations [in] Number of warm-up inferences (0: no warm-up)
+///
+/// @return Measured cold (first) and warm (subsequent) latencies
+WarmUpStatistics WarmUp(IInferenceEngine& inference_engine,
+                        const InputTensorInfo& input_tensor_info,
+                        const std::int32_t iterations);
+}  // namespace perception
+
+#endif  /// PERCEPTION_INFERENCE_ENGINE_INFERENCE_ENGINE_WARM_UP_H
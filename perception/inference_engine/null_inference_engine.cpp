@@ -4,23 +4,66 @@
 ///
 #include "perception/inference_engine/null_inference_engine.h"
 
+#include "perception/inference_engine/inference_engine_warm_up.h"
+
 namespace perception
 {
 
 NullInferenceEngine::NullInferenceEngine(const InferenceEngineParameters& params)
-    : results_{params.output_tensor_names.size()}
+    : results_{params.output_tensor_names.size()},
+      batch_results_(1U, results_),
+      input_tensor_info_{params.input_size, 3, CV_8U},
+      warm_up_iterations_{params.warm_up_iterations},
+      warm_up_statistics_{},
+      stage_latencies_{}
+{
+}
+
+void NullInferenceEngine::Init()
 {
+    warm_up_statistics_ = WarmUp(*this, input_tensor_info_, warm_up_iterations_);
 }
 
-void NullInferenceEngine::Init() {}
+void NullInferenceEngine::Execute(const Image& image)
+{
+    batch_results_.resize(1U, results_);
+}
 
-void NullInferenceEngine::Execute(const Image& image) {}
+void NullInferenceEngine::ExecuteBatch(const std::vector<Image>& images)
+{
+    batch_results_.resize(images.size(), results_);
+}
 
 void NullInferenceEngine::Shutdown() {}
 
-std::vector<cv::Mat> NullInferenceEngine::GetResults() const
+const std::vector<cv::Mat>& NullInferenceEngine::GetResults() const
 {
     return results_;
 }
 
+const std::vector<std::vector<cv::Mat>>& NullInferenceEngine::GetBatchResults() const
+{
+    return batch_results_;
+}
+
+const InputTensorInfo& NullInferenceEngine::GetInputTensorInfo() const
+{
+    return input_tensor_info_;
+}
+
+const WarmUpStatistics& NullInferenceEngine::GetWarmUpStatistics() const
+{
+    return warm_up_statistics_;
+}
+
+const InferenceStageLatencies& NullInferenceEngine::GetStageLatencies() const
+{
+    return stage_latencies_;
+}
+
+bool NullInferenceEngine::IsBatchingSupported() const
+{
+    return true;
+}
+
 }  // namespace perception
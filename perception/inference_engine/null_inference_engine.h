@@ -35,6 +35,11 @@ class NullInferenceEngine final : public IInferenceEngine
     /// @param image [in] Image to be fed as input to Inference Engine
     void Execute(const Image& image) override;
 
+    /// @brief Execute Inference with Null Inference Engine for a batch of images
+    ///
+    /// @param images [in] Images to be fed as input to Inference Engine
+    void ExecuteBatch(const std::vector<Image>& images) override;
+
     /// @brief Release Null Inference Engine
     void Shutdown() override;
 
@@ -42,11 +47,51 @@ class NullInferenceEngine final : public IInferenceEngine
     ///
     /// @return List of results (aka cv::Mat) for requested outputs (will be in same order as output_node_names provided
     ///         in InferenceEngineParameters)
-    std::vector<cv::Mat> GetResults() const override;
+    const std::vector<cv::Mat>& GetResults() const override;
+
+    /// @brief Provide results for each image of the last executed batch
+    ///
+    /// @return List of results per image (will be in same order as images provided to ExecuteBatch)
+    const std::vector<std::vector<cv::Mat>>& GetBatchResults() const override;
+
+    /// @brief Provide input tensor expected by the model (read at Init)
+    ///
+    /// @return Input size, channels and element type
+    const InputTensorInfo& GetInputTensorInfo() const override;
+
+    /// @brief Provide latencies measured while warming up the Inference Engine during Init
+    ///
+    /// @return Warm-up statistics (zero iterations, if warm-up is disabled)
+    const WarmUpStatistics& GetWarmUpStatistics() const override;
+
+    /// @brief Provide latencies of the stages of the last Execute/ExecuteBatch call
+    ///
+    /// @return Stage latencies (preprocess, invoke, postprocess)
+    const InferenceStageLatencies& GetStageLatencies() const override;
+
+    /// @brief Provide whether the model accepts more than one image per ExecuteBatch call (determined at Init)
+    ///
+    /// @return True, if ExecuteBatch accepts more than one image
+    bool IsBatchingSupported() const override;
 
   private:
     /// @brief Output Tensors saved as cv::Mat
     const std::vector<cv::Mat> results_;
+
+    /// @brief Output Tensors saved as cv::Mat for each image of the batch
+    std::vector<std::vector<cv::Mat>> batch_results_;
+
+    /// @brief Input tensor expected by the model
+    InputTensorInfo input_tensor_info_;
+
+    /// @brief Number of warm-up inferences run during Init
+    const std::int32_t warm_up_iterations_;
+
+    /// @brief Latencies measured during warm-up
+    WarmUpStatistics warm_up_statistics_;
+
+    /// @brief Latencies of the stages of the last inference
+    InferenceStageLatencies stage_latencies_;
 };
 
 }  // namespace perception
@@ -0,0 +1,483 @@
+///
+/// @file
+/// @copyright Copyright (c) 2023. MIT License
+///
+#include "perception/inference_engine/onnxruntime_inference_engine.h"
+
+#include "perception/common/logging.h"
+#include "perception/common/thread_affinity.h"
+#include "perception/inference_engine/inference_engine_warm_up.h"
+#include "perception/inference_engine/stage_latency.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <functional>
+#include <numeric>
+#include <utility>
+
+namespace perception
+{
+namespace
+{
+/// @brief Provide process-wide ONNX Runtime environment (shared by all the sessions, owns the global thread pools)
+///
+/// @return ONNX Runtime environment
+Ort::Env& GetEnvironment()
+{
+    static Ort::Env environment{ORT_LOGGING_LEVEL_WARNING, "perception"};
+    return environment;
+}
+
+/// @brief Provide number of elements for given tensor shape
+///
+/// @param shape [in] Tensor shape (all dimensions known)
+///
+/// @return Product of all the dimensions
+template <typename Shape>
+std::int64_t GetNumberOfElements(const Shape& shape)
+{
+    return std::accumulate(shape.cbegin(), shape.cend(), std::int64_t{1}, std::multiplies<std::int64_t>{});
+}
+
+/// @brief Provide index of the named input
+///
+/// @param session [in] ONNX Runtime session
+/// @param name [in] Input Node/Tensor Name
+///
+/// @return Index of the input
+std::size_t GetInputIndex(const Ort::Session& session, const std::string& name)
+{
+    Ort::AllocatorWithDefaultOptions allocator{};
+    for (std::size_t index = 0U; index < session.GetInputCount(); ++index)
+    {
+        if (name == session.GetInputNameAllocated(index, allocator).get())
+        {
+            return index;
+        }
+    }
+    LOG(FATAL) << "Model has no input '" << name << "'";
+    return 0U;
+}
+
+/// @brief Provide index of the named output
+///
+/// @param session [in] ONNX Runtime session
+/// @param name [in] Output Node/Tensor Name
+///
+/// @return Index of the output
+std::size_t GetOutputIndex(const Ort::Session& session, const std::string& name)
+{
+    Ort::AllocatorWithDefaultOptions allocator{};
+    for (std::size_t index = 0U; index < session.GetOutputCount(); ++index)
+    {
+        if (name == session.GetOutputNameAllocated(index, allocator).get())
+        {
+            return index;
+        }
+    }
+    LOG(FATAL) << "Model has no output '" << name << "'";
+    return 0U;
+}
+
+/// @brief Converts (float) Ort::Value to Image (aka cv::Mat)
+///
+/// @param tensor [in] Ort::Value tensor in [NxHxWxC form] (element type checked at Init)
+/// @param batch_index [in] Index of the image within the batch (N)
+/// @param batch_size [in] Number of images fed to the model (leading dimension of the tensor has to match)
+///
+/// @return Equivalent image (aka cv::Mat) for given batch index of tensor (view on the tensor contents).
+cv::Mat ConvertToMatrix(Ort::Value& tensor, const std::int64_t batch_index, const std::int64_t batch_size)
+{
+    const auto shape_info = tensor.GetTensorTypeAndShapeInfo();
+    // leading dimensions are read into fixed storage, i.e. no shape vector is allocated for each frame
+    std::array<std::int64_t, 4U> shape{};
+    const auto number_of_dimensions = std::min(shape_info.GetDimensionsCount(), shape.size());
+    shape_info.GetDimensions(shape.data(), number_of_dimensions);
+    CHECK((batch_size == 1) || ((number_of_dimensions > 0U) && (shape.front() == batch_size)))
+        << "Output tensor has no batch dimension for batch size " << batch_size << ", model does not support batching";
+
+    const auto rows = number_of_dimensions > 1U ? static_cast<std::int32_t>(shape.at(1)) : 1;
+    const auto cols = number_of_dimensions > 2U ? static_cast<std::int32_t>(shape.at(2)) : 1;
+    const auto channels = number_of_dimensions > 3U ? static_cast<std::int32_t>(shape.at(3)) : 1;
+    const auto batch_stride = static_cast<std::int64_t>(shape_info.GetElementCount()) / batch_size;
+    auto* tensor_ptr = tensor.GetTensorMutableData<float>() + (batch_index * batch_stride);
+    return cv::Mat{rows, cols, CV_32FC(channels), tensor_ptr};
+}
+
+/// @brief Provide memory layout of the input tensor, derived from its declared shape (channels are either the second
+/// or the last dimension)
+///
+/// @param shape [in] Declared input shape (-1 for dynamic dimensions)
+///
+/// @return kNCHW, if only the second dimension matches a number of channels (1 or 3), otherwise kNHWC
+TensorLayout GetInputLayout(const std::vector<std::int64_t>& shape)
+{
+    const auto is_channels = [](const std::int64_t dimension) { return (dimension == 1) || (dimension == 3); };
+    return ((shape.size() == 4U) && is_channels(shape.at(1)) && !is_channels(shape.at(3))) ? TensorLayout::kNCHW
+                                                                                             : TensorLayout::kNHWC;
+}
+
+/// @brief Provide whether the model declares a dynamic batch dimension for the given input and output tensors
+///
+/// @param session [in] ONNX Runtime session
+/// @param input_tensor_name [in] Input Node/Tensor Name
+/// @param output_tensor_names [in] Output Node/Tensor Names
+///
+/// @return True, if the leading dimension of the input and all the outputs is dynamic
+bool ReadBatchingSupport(const Ort::Session& session,
+                         const std::string& input_tensor_name,
+                         const std::vector<std::string>& output_tensor_names)
+{
+    const auto has_batch_dimension = [](const Ort::TypeInfo& type_info) {
+        const auto shape = type_info.GetTensorTypeAndShapeInfo().GetShape();
+        return !shape.empty() && (shape.front() < 0);
+    };
+    return has_batch_dimension(session.GetInputTypeInfo(GetInputIndex(session, input_tensor_name))) &&
+           std::all_of(output_tensor_names.cbegin(),
+                       output_tensor_names.cend(),
+                       [&session, &has_batch_dimension](const auto& name) {
+                           return has_batch_dimension(session.GetOutputTypeInfo(GetOutputIndex(session, name)));
+                       });
+}
+}  // namespace
+
+OnnxRuntimeInferenceEngine::OnnxRuntimeInferenceEngine(const InferenceEngineParameters& params)
+    : session_{nullptr},
+      io_binding_{nullptr},
+      run_options_{},
+      memory_info_{Ort::MemoryInfo::CreateCpu(OrtArenaAllocator, OrtMemTypeDefault)},
+      input_element_type_{ONNX_TENSOR_ELEMENT_DATA_TYPE_UNDEFINED},
+      input_shape_{},
+      input_layout_{TensorLayout::kNHWC},
+      image_preprocessor_{TensorLayout::kNHWC, params.swap_red_blue},
+      input_scale_{params.input_scale},
+      input_offset_{params.input_offset},
+      swap_red_blue_{params.swap_red_blue},
+      input_buffer_{},
+      input_tensor_{nullptr},
+      output_buffers_{},
+      output_tensors_{},
+      has_dynamic_outputs_{false},
+      input_tensor_name_{params.input_tensor_name},
+      output_tensor_names_{params.output_tensor_names},
+      model_path_{params.model_path},
+      intra_op_threads_{params.intra_op_threads},
+      inter_op_threads_{params.inter_op_threads},
+      cpu_affinity_mask_{params.cpu_affinity_mask},
+      graph_optimization_{params.graph_optimization},
+      batching_supported_{false},
+      batch_results_(1U),
+      input_tensor_info_{params.input_size, 3, CV_8U},
+      warm_up_iterations_{params.warm_up_iterations},
+      warm_up_statistics_{},
+      stage_latencies_{}
+{
+}
+
+void OnnxRuntimeInferenceEngine::Init()
+{
+    // session thread pools are spawned while creating the session, hence inherit the affinity (calling thread is
+    // restored once Init is done, e.g. threads spawned later by the node runner are not pinned)
+    const ScopedThreadAffinity scoped_thread_affinity{cpu_affinity_mask_};
+
+    Ort::SessionOptions session_options{};
+    if (intra_op_threads_ > 0)
+    {
+        session_options.SetIntraOpNumThreads(intra_op_threads_);
+    }
+    if (inter_op_threads_ > 0)
+    {
+        session_options.SetInterOpNumThreads(inter_op_threads_);
+    }
+    session_options.SetExecutionMode((inter_op_threads_ > 1) ? ExecutionMode::ORT_PARALLEL
+                                                             : ExecutionMode::ORT_SEQUENTIAL);
+    session_options.SetGraphOptimizationLevel(graph_optimization_ ? GraphOptimizationLevel::ORT_ENABLE_ALL
+                                                                   : GraphOptimizationLevel::ORT_DISABLE_ALL);
+
+    try
+    {
+        session_ = Ort::Session{GetEnvironment(), model_path_.c_str(), session_options};
+    }
+    catch (const Ort::Exception& exception)
+    {
+        LOG(FATAL) << "Failed to load onnx model '" << model_path_ << "', (Message: " << exception.what() << ")";
+    }
+    io_binding_ = Ort::IoBinding{session_};
+
+    const auto input_index = GetInputIndex(session_, input_tensor_name_);
+    const auto input_type_info = session_.GetInputTypeInfo(input_index);
+    const auto input_info = input_type_info.GetTensorTypeAndShapeInfo();
+    input_element_type_ = input_info.GetElementType();
+    CHECK(input_element_type_ == ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT8 ||
+          input_element_type_ == ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT)
+        << "Cannot handle input type " << input_element_type_ << " yet";
+    input_layout_ = GetInputLayout(input_info.GetShape());
+    image_preprocessor_ = ImagePreprocessor{input_layout_, swap_red_blue_};
+    input_tensor_info_ = ReadInputTensorInfo();
+
+    for (const auto& name : output_tensor_names_)
+    {
+        const auto output_type_info = session_.GetOutputTypeInfo(GetOutputIndex(session_, name));
+        const auto output_element_type = output_type_info.GetTensorTypeAndShapeInfo().GetElementType();
+        CHECK(output_element_type == ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT)
+            << "Cannot handle type " << output_element_type << " of output '" << name << "' yet";
+    }
+    batching_supported_ = ReadBatchingSupport(session_, input_tensor_name_, output_tensor_names_);
+
+    output_buffers_.resize(output_tensor_names_.size());
+    output_tensors_.clear();
+    for (std::size_t index = 0U; index < output_tensor_names_.size(); ++index)
+    {
+        output_tensors_.emplace_back(nullptr);
+    }
+    batch_results_.front().reserve(output_tensor_names_.size());
+
+    LOG(INFO) << "Successfully loaded onnx model from '" << model_path_ << "'.";
+
+    warm_up_statistics_ = WarmUp(*this, input_tensor_info_, warm_up_iterations_);
+}
+
+void OnnxRuntimeInferenceEngine::Execute(const Image& image)
+{
+    MeasureLatency(stage_latencies_.preprocess, [this, &image] { UpdateInput(&image, 1U); });
+    MeasureLatency(stage_latencies_.invoke, [this] { UpdateTensors(); });
+    MeasureLatency(stage_latencies_.postprocess, [this] { UpdateOutputs(); });
+}
+
+void OnnxRuntimeInferenceEngine::ExecuteBatch(const std::vector<Image>& images)
+{
+    CHECK(!images.empty()) << "Received empty batch.";
+    CHECK((images.size() == 1U) || batching_supported_)
+        << "Model '" << model_path_ << "' does not support batching, received " << images.size() << " images.";
+    MeasureLatency(stage_latencies_.preprocess, [this, &images] { UpdateInput(images.data(), images.size()); });
+    MeasureLatency(stage_latencies_.invoke, [this] { UpdateTensors(); });
+    MeasureLatency(stage_latencies_.postprocess, [this] { UpdateOutputs(); });
+}
+
+void OnnxRuntimeInferenceEngine::Shutdown()
+{
+    output_tensors_.clear();
+    input_tensor_ = Ort::Value{nullptr};
+    io_binding_ = Ort::IoBinding{nullptr};
+    session_ = Ort::Session{nullptr};
+    input_shape_.fill(0);
+}
+
+const std::vector<cv::Mat>& OnnxRuntimeInferenceEngine::GetResults() const
+{
+    return batch_results_.front();
+}
+
+const std::vector<std::vector<cv::Mat>>& OnnxRuntimeInferenceEngine::GetBatchResults() const
+{
+    return batch_results_;
+}
+
+const InputTensorInfo& OnnxRuntimeInferenceEngine::GetInputTensorInfo() const
+{
+    return input_tensor_info_;
+}
+
+const WarmUpStatistics& OnnxRuntimeInferenceEngine::GetWarmUpStatistics() const
+{
+    return warm_up_statistics_;
+}
+
+const InferenceStageLatencies& OnnxRuntimeInferenceEngine::GetStageLatencies() const
+{
+    return stage_latencies_;
+}
+
+bool OnnxRuntimeInferenceEngine::IsBatchingSupported() const
+{
+    return batching_supported_;
+}
+
+void OnnxRuntimeInferenceEngine::UpdateInput(const Image* images, const std::size_t number_of_images)
+{
+    const auto& image = images[0];
+    const auto input_size = input_tensor_info_.size.empty() ? image.size() : input_tensor_info_.size;
+    std::array<std::int64_t, 4U> input_shape{{static_cast<std::int64_t>(number_of_images),
+                                              input_size.height,
+                                              input_size.width,
+                                              input_tensor_info_.channels}};
+    if (input_layout_ == TensorLayout::kNCHW)
+    {
+        std::rotate(input_shape.begin() + 1, input_shape.begin() + 3, input_shape.end());
+    }
+    if (input_shape != input_shape_)
+    {
+        BindBuffers(input_shape);
+    }
+
+    const auto image_size = static_cast<std::size_t>(input_size.area() * input_tensor_info_.channels);
+    for (std::size_t index = 0U; index < number_of_images; ++index)
+    {
+        CHECK(images[index].size() == image.size() && images[index].type() == image.type())
+            << "Batched images must have same size and type.";
+        CHECK(images[index].channels() == input_tensor_info_.channels)
+            << "Model '" << model_path_ << "' expects " << input_tensor_info_.channels << "-channel images (received "
+            << images[index].channels() << ")";
+        if (input_buffer_.depth() == CV_8U)
+        {
+            image_preprocessor_.Preprocess(
+                images[index], input_size, 1.0F, 0.0F, input_buffer_.ptr<std::uint8_t>() + (index * image_size));
+        }
+        else
+        {
+            image_preprocessor_.Preprocess(images[index],
+                                           input_size,
+                                           input_scale_,
+                                           input_offset_,
+                                           input_buffer_.ptr<float>() + (index * image_size));
+        }
+    }
+}
+
+void OnnxRuntimeInferenceEngine::UpdateTensors()
+{
+    session_.Run(run_options_, io_binding_);
+    if (has_dynamic_outputs_)
+    {
+        FetchDynamicOutputs();
+    }
+
+    LOG_EVERY_T(INFO, std::chrono::seconds{5})
+        << "Successfully received results " << output_tensors_.size() << " outputs.";
+}
+
+void OnnxRuntimeInferenceEngine::FetchDynamicOutputs()
+{
+    // values are provided in binding order as an array allocated by ONNX Runtime (rather than the std::vector built by
+    // Ort::IoBinding::GetOutputValues), statically shaped outputs keep the values created at BindBuffers
+    Ort::AllocatorWithDefaultOptions allocator{};
+    OrtValue** values{nullptr};
+    std::size_t number_of_values{0U};
+    Ort::ThrowOnError(Ort::GetApi().GetBoundOutputValues(io_binding_, allocator, &values, &number_of_values));
+    for (std::size_t index = 0U; index < number_of_values; ++index)
+    {
+        Ort::Value value{values[index]};
+        if (output_buffers_.at(index).empty())
+        {
+            output_tensors_.at(index) = std::move(value);
+        }
+    }
+    if (values != nullptr)
+    {
+        allocator.Free(values);
+    }
+}
+
+void OnnxRuntimeInferenceEngine::UpdateOutputs()
+{
+    const auto batch_size = input_shape_.front();
+    batch_results_.resize(static_cast<std::size_t>(batch_size));
+    for (std::int64_t batch_index = 0; batch_index < batch_size; ++batch_index)
+    {
+        auto& results = batch_results_.at(static_cast<std::size_t>(batch_index));
+        results.resize(output_tensors_.size());
+        std::transform(output_tensors_.begin(),
+                       output_tensors_.end(),
+                       results.begin(),
+                       [batch_index, batch_size](auto& tensor) {
+                           return ConvertToMatrix(tensor, batch_index, batch_size);
+                       });
+    }
+}
+
+void OnnxRuntimeInferenceEngine::BindBuffers(const std::array<std::int64_t, 4U>& input_shape)
+{
+    io_binding_.ClearBoundInputs();
+    io_binding_.ClearBoundOutputs();
+    has_dynamic_outputs_ = false;
+
+    // images stacked vertically, i.e. (N x H) x W x C for NHWC and (N x C x H) x W x 1 for NCHW
+    const auto nchw = (input_layout_ == TensorLayout::kNCHW);
+    const auto rows = static_cast<std::int32_t>(input_shape.at(0) * input_shape.at(1) * (nchw ? input_shape.at(2) : 1));
+    const auto cols = static_cast<std::int32_t>(nchw ? input_shape.at(3) : input_shape.at(2));
+    const auto channels = nchw ? 1 : static_cast<std::int32_t>(input_shape.at(3));
+    const auto number_of_elements = static_cast<std::size_t>(GetNumberOfElements(input_shape));
+    if (input_element_type_ == ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT8)
+    {
+        input_buffer_.create(rows, cols, CV_8UC(channels));
+        input_tensor_ = Ort::Value::CreateTensor<std::uint8_t>(memory_info_,
+                                                               input_buffer_.ptr<std::uint8_t>(),
+                                                               number_of_elements,
+                                                               input_shape.data(),
+                                                               input_shape.size());
+    }
+    else
+    {
+        input_buffer_.create(rows, cols, CV_32FC(channels));
+        input_tensor_ = Ort::Value::CreateTensor<float>(
+            memory_info_, input_buffer_.ptr<float>(), number_of_elements, input_shape.data(), input_shape.size());
+    }
+    io_binding_.BindInput(input_tensor_name_.c_str(), input_tensor_);
+
+    for (std::size_t index = 0U; index < output_tensor_names_.size(); ++index)
+    {
+        const auto& name = output_tensor_names_.at(index);
+        // tensor info is a view on the type info, hence type info has to be kept alive
+        const auto output_type_info = session_.GetOutputTypeInfo(GetOutputIndex(session_, name));
+        const auto output_info = output_type_info.GetTensorTypeAndShapeInfo();
+        auto output_shape = output_info.GetShape();
+        if (!output_shape.empty() && (output_shape.front() < 0))
+        {
+            output_shape.front() = input_shape.front();
+        }
+
+        const auto is_static = std::all_of(
+            output_shape.cbegin(), output_shape.cend(), [](const auto dimension) { return dimension > 0; });
+        if (is_static)
+        {
+            auto& output_buffer = output_buffers_.at(index);
+            const auto output_size = GetNumberOfElements(output_shape);
+            output_buffer.create(1, static_cast<std::int32_t>(output_size), CV_32FC1);
+            auto& output_tensor = output_tensors_.at(index);
+            output_tensor = Ort::Value::CreateTensor<float>(memory_info_,
+                                                            output_buffer.ptr<float>(),
+                                                            static_cast<std::size_t>(output_size),
+                                                            output_shape.data(),
+                                                            output_shape.size());
+            io_binding_.BindOutput(name.c_str(), output_tensor);
+        }
+        else
+        {
+            // shape is only known after the run (e.g. number of detections), hence allocated by ONNX Runtime
+            output_buffers_.at(index).release();
+            output_tensors_.at(index) = Ort::Value{nullptr};
+            io_binding_.BindOutput(name.c_str(), memory_info_);
+            has_dynamic_outputs_ = true;
+        }
+    }
+
+    input_shape_ = input_shape;
+}
+
+InputTensorInfo OnnxRuntimeInferenceEngine::ReadInputTensorInfo() const
+{
+    auto input_tensor_info = input_tensor_info_;
+    const auto input_index = GetInputIndex(session_, input_tensor_name_);
+    const auto shape = session_.GetInputTypeInfo(input_index).GetTensorTypeAndShapeInfo().GetShape();
+    if (shape.size() == 4U)
+    {
+        // [NxCxHxW form] or [NxHxWxC form]
+        const auto nchw = (input_layout_ == TensorLayout::kNCHW);
+        const auto height = shape.at(nchw ? 2U : 1U);
+        const auto width = shape.at(nchw ? 3U : 2U);
+        const auto channels = shape.at(nchw ? 1U : 3U);
+        if ((height > 0) && (width > 0))
+        {
+            input_tensor_info.size = cv::Size{static_cast<std::int32_t>(width), static_cast<std::int32_t>(height)};
+        }
+        if (channels > 0)
+        {
+            input_tensor_info.channels = static_cast<std::int32_t>(channels);
+        }
+    }
+    input_tensor_info.depth = (input_element_type_ == ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT) ? CV_32F : CV_8U;
+    return input_tensor_info;
+}
+
+}  // namespace perception
@@ -0,0 +1,196 @@
+///
+/// @file
+/// @copyright Copyright (c) 2023. MIT License
+///
+#ifndef PERCEPTION_INFERENCE_ENGINE_ONNXRUNTIME_INFERENCE_ENGINE_H
+#define PERCEPTION_INFERENCE_ENGINE_ONNXRUNTIME_INFERENCE_ENGINE_H
+
+#include "perception/datatypes/inference_engine_type.h"
+#include "perception/inference_engine/i_inference_engine.h"
+#include "perception/inference_engine/image_preprocessor.h"
+
+#include <onnxruntime_cxx_api.h>
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace perception
+{
+/// @brief ONNX Runtime Inference Engine class (CPU execution provider). Input and (statically shaped) output tensors
+/// are bound to preallocated buffers (IO binding), which are reallocated only if the input shape changes.
+class OnnxRuntimeInferenceEngine final : public IInferenceEngine
+{
+  public:
+    /// @brief Constructor
+    ///
+    /// @param params [in] Inference Engine Parameters such as model input/output node names
+    explicit OnnxRuntimeInferenceEngine(const InferenceEngineParameters& params);
+
+    /// @brief Initialise ONNX Runtime Inference Engine
+    void Init() override;
+
+    /// @brief Execute Inference with ONNX Runtime Inference Engine
+    ///
+    /// @param image [in] Image to be fed as input to Inference Engine
+    void Execute(const Image& image) override;
+
+    /// @brief Execute Inference with ONNX Runtime Inference Engine for a batch of images (single session run)
+    ///
+    /// @param images [in] Images (of same size and type) to be fed as input to Inference Engine
+    void ExecuteBatch(const std::vector<Image>& images) override;
+
+    /// @brief Release ONNX Runtime Inference Engine
+    void Shutdown() override;
+
+    /// @brief Provide results in terms of Matrix
+    ///
+    /// @return List of results (aka cv::Mat) for requested outputs (will be in same order as output_node_names provided
+    ///         in InferenceEngineParameters)
+    const std::vector<cv::Mat>& GetResults() const override;
+
+    /// @brief Provide results for each image of the last executed batch
+    ///
+    /// @return List of results per image (will be in same order as images provided to ExecuteBatch)
+    const std::vector<std::vector<cv::Mat>>& GetBatchResults() const override;
+
+    /// @brief Provide input tensor expected by the model (read at Init)
+    ///
+    /// @return Input size, channels and element type
+    const InputTensorInfo& GetInputTensorInfo() const override;
+
+    /// @brief Provide latencies measured while warming up the Inference Engine during Init
+    ///
+    /// @return Warm-up statistics (zero iterations, if warm-up is disabled)
+    const WarmUpStatistics& GetWarmUpStatistics() const override;
+
+    /// @brief Provide latencies of the stages of the last Execute/ExecuteBatch call
+    ///
+    /// @return Stage latencies (preprocess, invoke, postprocess)
+    const InferenceStageLatencies& GetStageLatencies() const override;
+
+    /// @brief Provide whether the model accepts more than one image per ExecuteBatch call (determined at Init)
+    ///
+    /// @return True, if ExecuteBatch accepts more than one image
+    bool IsBatchingSupported() const override;
+
+  private:
+    /// @brief Updates Input Tensor by preprocessing images directly into the (batched) input buffer. Rebinds
+    /// input/output buffers, if input shape changes.
+    ///
+    /// @param images [in] Input images to be fed to Inference Engine
+    /// @param number_of_images [in] Number of input images (i.e. batch size)
+    void UpdateInput(const Image* images, const std::size_t number_of_images);
+
+    /// @brief Updates Output Tensors by running the session with bound buffers
+    void UpdateTensors();
+
+    /// @brief Fetch the values of dynamically shaped outputs, allocated by ONNX Runtime during the last run
+    void FetchDynamicOutputs();
+
+    /// @brief Converts output tensors to cv::Mat results (views on the output buffers)
+    void UpdateOutputs();
+
+    /// @brief (Re)allocate input/output buffers for given input shape and bind them to the session
+    ///
+    /// @param input_shape [in] Input shape [NxHxWxC or NxCxHxW form]
+    void BindBuffers(const std::array<std::int64_t, 4U>& input_shape);
+
+    /// @brief Read input tensor declared by the model
+    ///
+    /// @return Declared input size, channels and element type (input_tensor_info_ for dynamic dimensions)
+    InputTensorInfo ReadInputTensorInfo() const;
+
+    /// @brief ONNX Runtime session (loaded model)
+    Ort::Session session_;
+
+    /// @brief Binding of input/output buffers to the session
+    Ort::IoBinding io_binding_;
+
+    /// @brief Run options
+    Ort::RunOptions run_options_;
+
+    /// @brief CPU memory description for bound buffers
+    Ort::MemoryInfo memory_info_;
+
+    /// @brief Element type of the input tensor (uint8 or float)
+    ONNXTensorElementDataType input_element_type_;
+
+    /// @brief Shape of the bound input tensor [NxHxWxC or NxCxHxW form]
+    std::array<std::int64_t, 4U> input_shape_;
+
+    /// @brief Memory layout of the input tensor (derived from the declared input shape at Init)
+    TensorLayout input_layout_;
+
+    /// @brief Preprocessing stage, writing input images (RGB) to the input buffer in input_layout_
+    ImagePreprocessor image_preprocessor_;
+
+    /// @brief Scale applied to each pixel of float inputs
+    const float input_scale_;
+
+    /// @brief Offset added to each scaled pixel of float inputs
+    const float input_offset_;
+
+    /// @brief Convert input images from BGR to RGB channel order
+    const bool swap_red_blue_;
+
+    /// @brief Input buffer (images stacked vertically, planes stacked vertically for NCHW)
+    cv::Mat input_buffer_;
+
+    /// @brief Bound input tensor (view on input_buffer_)
+    Ort::Value input_tensor_;
+
+    /// @brief Output buffers (for statically shaped outputs, only float outputs are accepted)
+    std::vector<cv::Mat> output_buffers_;
+
+    /// @brief Output Tensors (created at BindBuffers for statically shaped outputs, fetched after each run for
+    /// dynamically shaped outputs, which are allocated by ONNX Runtime)
+    std::vector<Ort::Value> output_tensors_;
+
+    /// @brief Any of the bound outputs is dynamically shaped (i.e. has to be fetched after each run)
+    bool has_dynamic_outputs_;
+
+    /// @brief Input Tensor Name
+    const std::string input_tensor_name_;
+
+    /// @brief Output Tensor Names
+    const std::vector<std::string> output_tensor_names_;
+
+    /// @brief Path to model (*.onnx)
+    const std::string model_path_;
+
+    /// @brief Number of threads used to parallelize execution of a single operation (0: backend default)
+    const std::int32_t intra_op_threads_;
+
+    /// @brief Number of threads used to execute independent operations in parallel (0: backend default)
+    const std::int32_t inter_op_threads_;
+
+    /// @brief CPUs to which the engine threads are pinned (0: not pinned)
+    const std::uint64_t cpu_affinity_mask_;
+
+    /// @brief Enable graph optimizations
+    const bool graph_optimization_;
+
+    /// @brief Model declares a dynamic batch dimension for the input and all the requested outputs
+    bool batching_supported_;
+
+    /// @brief Output Tensors saved as cv::Mat for each image of the batch
+    std::vector<std::vector<cv::Mat>> batch_results_;
+
+    /// @brief Input tensor expected by the model
+    InputTensorInfo input_tensor_info_;
+
+    /// @brief Number of warm-up inferences run during Init
+    const std::int32_t warm_up_iterations_;
+
+    /// @brief Latencies measured during warm-up
+    WarmUpStatistics warm_up_statistics_;
+
+    /// @brief Latencies of the stages of the last inference
+    InferenceStageLatencies stage_latencies_;
+};
+
+}  // namespace perception
+
+#endif  /// PERCEPTION_INFERENCE_ENGINE_ONNXRUNTIME_INFERENCE_ENGINE_H
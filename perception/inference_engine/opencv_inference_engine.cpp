@@ -5,60 +5,232 @@
 #include "perception/inference_engine/opencv_inference_engine.h"
 
 #include "perception/common/logging.h"
+#include "perception/inference_engine/inference_engine_warm_up.h"
+#include "perception/inference_engine/stage_latency.h"
 
 #include <opencv4/opencv2/imgproc.hpp>
 
+#include <algorithm>
+#include <array>
+
 namespace perception
 {
+namespace
+{
+/// @brief Number of values per detection of the DetectionOutput layer, i.e. [image_id, label, confidence, xmin, ymin,
+/// xmax, ymax]
+constexpr std::int32_t kDetectionOutputSize{7};
+
+/// @brief Provide whether the blob is the output of a DetectionOutput layer (1x1xNx7 form), which has no batch
+/// dimension but encodes the image id within each detection
+///
+/// @param blob [in] Output blob
+///
+/// @return True, if blob contains detections of all the images of the batch
+bool IsDetectionOutput(const cv::Mat& blob)
+{
+    return (blob.dims == 4) && (blob.size[0] == 1) && (blob.size[1] == 1) && (blob.size[3] == kDetectionOutputSize);
+}
+
+/// @brief Provide view on the detections of the DetectionOutput blob, belonging to the provided image of the batch
+///
+/// @param blob [in] Output blob of DetectionOutput layer (1x1xNx7 form, detections are emitted image by image)
+/// @param batch_index [in] Index of the image within the batch
+///
+/// @return View on the detections of the image (1x1xMx7 form)
+cv::Mat GetDetectionSlice(const cv::Mat& blob, const std::int32_t batch_index)
+{
+    const cv::Mat detections{blob.size[2], kDetectionOutputSize, CV_32F, const_cast<uchar*>(blob.ptr())};
+    const auto belongs_to_image = [&detections, batch_index](const std::int32_t row) {
+        return static_cast<std::int32_t>(detections.at<float>(row, 0)) == batch_index;
+    };
+
+    std::int32_t first_row{0};
+    while ((first_row < detections.rows) && !belongs_to_image(first_row))
+    {
+        ++first_row;
+    }
+    std::int32_t end_row{first_row};
+    while ((end_row < detections.rows) && belongs_to_image(end_row))
+    {
+        ++end_row;
+    }
+    for (std::int32_t row = end_row; row < detections.rows; ++row)
+    {
+        CHECK(!belongs_to_image(row)) << "Detections of image " << batch_index << " are not contiguous.";
+    }
+    const auto number_of_rows = end_row - first_row;
+
+    const std::array<std::int32_t, 4> sizes{1, 1, number_of_rows, kDetectionOutputSize};
+    return cv::Mat{static_cast<std::int32_t>(sizes.size()),
+                   sizes.data(),
+                   CV_32F,
+                   const_cast<uchar*>(detections.ptr(std::min(first_row, detections.rows - 1)))};
+}
+
+/// @brief Provide view on the part of the (batched) output blob, belonging to the provided image of the batch
+///
+/// @param blob [in] Output blob (NxCxHxW form, or 1x1xNx7 form for DetectionOutput layer)
+/// @param batch_size [in] Number of images in the batch (N)
+/// @param batch_index [in] Index of the image within the batch
+///
+/// @return View on the blob contents for the image (batch dimension of size 1). Detections of the DetectionOutput
+/// layer are split by the image id encoded within each detection.
+cv::Mat GetBatchSlice(const cv::Mat& blob, const std::int32_t batch_size, const std::int32_t batch_index)
+{
+    if (batch_size == 1)
+    {
+        return blob;
+    }
+    if (IsDetectionOutput(blob))
+    {
+        return GetDetectionSlice(blob, batch_index);
+    }
+    CHECK((blob.dims > 1) && (blob.size[0] == batch_size))
+        << "Output blob has no batch dimension for batch size " << batch_size << ", model does not support batching";
+
+    std::array<std::int32_t, CV_MAX_DIM> sizes{};
+    std::copy(blob.size.p, blob.size.p + blob.dims, sizes.begin());
+    sizes[0] = 1;
+    return cv::Mat{blob.dims, sizes.data(), blob.type(), const_cast<uchar*>(blob.ptr(batch_index)), blob.step.p};
+}
+}  // namespace
+
+
 OpenCVInferenceEngine::OpenCVInferenceEngine(const InferenceEngineParameters& params)
     : net_{},
+      image_preprocessor_{TensorLayout::kNCHW, params.swap_red_blue},
+      input_scale_{params.input_scale},
+      input_offset_{params.input_offset},
       input_tensor_{},
       input_tensor_name_{params.input_tensor_name},
       output_tensors_{},
       output_tensor_names_{params.output_tensor_names},
       model_path_{params.model_path},
-      config_path_{params.config_path}
+      config_path_{params.config_path},
+      intra_op_threads_{params.intra_op_threads},
+      batch_results_(1U),
+      input_tensor_info_{params.input_size, 3, CV_32F},
+      warm_up_iterations_{params.warm_up_iterations},
+      warm_up_statistics_{},
+      stage_latencies_{}
 {
 }
 
 void OpenCVInferenceEngine::Init()
 {
+    // OpenCV thread pool is process-wide (i.e. shared by all the OpenCV models and algorithms)
+    if (intra_op_threads_ > 0)
+    {
+        cv::setNumThreads(intra_op_threads_);
+    }
+
     net_ = cv::dnn::readNet(model_path_, config_path_);
     CHECK(!net_.empty()) << "Failed to load opencv model '" << model_path_ << "'";
+
+    output_tensors_.reserve(output_tensor_names_.size());
+    batch_results_.front().reserve(output_tensor_names_.size());
+
     LOG(INFO) << "Successfully loaded opencv model from '" << model_path_ << "'.";
+
+    // first forward pass allocates layer blobs and fuses layers
+    warm_up_statistics_ = WarmUp(*this, input_tensor_info_, warm_up_iterations_);
 }
 
 void OpenCVInferenceEngine::Execute(const Image& image)
 {
-    UpdateInput(image);
-    UpdateTensors();
-    UpdateOutputs();
+    MeasureLatency(stage_latencies_.preprocess, [this, &image] { UpdateInput(&image, 1U); });
+    MeasureLatency(stage_latencies_.invoke, [this] { UpdateTensors(); });
+    MeasureLatency(stage_latencies_.postprocess, [this] { UpdateOutputs(); });
+}
+
+void OpenCVInferenceEngine::ExecuteBatch(const std::vector<Image>& images)
+{
+    CHECK(!images.empty()) << "Received empty batch.";
+    MeasureLatency(stage_latencies_.preprocess, [this, &images] { UpdateInput(images.data(), images.size()); });
+    MeasureLatency(stage_latencies_.invoke, [this] { UpdateTensors(); });
+    MeasureLatency(stage_latencies_.postprocess, [this] { UpdateOutputs(); });
 }
 
 void OpenCVInferenceEngine::Shutdown() {}
 
-std::vector<cv::Mat> OpenCVInferenceEngine::GetResults() const
+const std::vector<cv::Mat>& OpenCVInferenceEngine::GetResults() const
+{
+    return batch_results_.front();
+}
+
+const std::vector<std::vector<cv::Mat>>& OpenCVInferenceEngine::GetBatchResults() const
+{
+    return batch_results_;
+}
+
+const InputTensorInfo& OpenCVInferenceEngine::GetInputTensorInfo() const
+{
+    return input_tensor_info_;
+}
+
+const WarmUpStatistics& OpenCVInferenceEngine::GetWarmUpStatistics() const
+{
+    return warm_up_statistics_;
+}
+
+const InferenceStageLatencies& OpenCVInferenceEngine::GetStageLatencies() const
+{
+    return stage_latencies_;
+}
+
+bool OpenCVInferenceEngine::IsBatchingSupported() const
 {
-    return results_;
+    // blobs are batched by the dnn module (DetectionOutput encodes the image id within each detection)
+    return true;
 }
 
-void OpenCVInferenceEngine::UpdateInput(const Image& image)
+void OpenCVInferenceEngine::UpdateInput(const Image* images, const std::size_t number_of_images)
 {
-    input_tensor_ = cv::dnn::blobFromImage(image);
+    const auto& image = images[0];
+    const auto input_size = input_tensor_info_.size.empty() ? image.size() : input_tensor_info_.size;
+    const std::array<std::int32_t, 4> sizes{
+        static_cast<std::int32_t>(number_of_images), input_tensor_info_.channels, input_size.height, input_size.width};
+    input_tensor_.create(static_cast<std::int32_t>(sizes.size()), sizes.data(), CV_32F);
+    for (std::size_t index = 0U; index < number_of_images; ++index)
+    {
+        CHECK(images[index].size() == image.size() && images[index].type() == image.type())
+            << "Batched images must have same size and type.";
+        CHECK(images[index].channels() == input_tensor_info_.channels)
+            << "Model '" << model_path_ << "' expects " << input_tensor_info_.channels << "-channel images (received "
+            << images[index].channels() << ")";
+        image_preprocessor_.Preprocess(images[index],
+                                       input_size,
+                                       input_scale_,
+                                       input_offset_,
+                                       input_tensor_.ptr<float>(static_cast<std::int32_t>(index)));
+    }
     net_.setInput(input_tensor_, input_tensor_name_);
 }
 
 void OpenCVInferenceEngine::UpdateTensors()
 {
     net_.forward(output_tensors_, output_tensor_names_);
-    LOG(INFO) << "Successfully received results " << output_tensors_.size() << " outputs.";
+    LOG_EVERY_T(INFO, std::chrono::seconds{5})
+        << "Successfully received results " << output_tensors_.size() << " outputs.";
 
     /// @todo Why output_tensors_ does not contain any bbox?
 }
 
 void OpenCVInferenceEngine::UpdateOutputs()
 {
-    std::copy(output_tensors_.cbegin(), output_tensors_.cend(), std::back_inserter(results_));
+    const auto batch_size = input_tensor_.size[0];
+    batch_results_.resize(static_cast<std::size_t>(batch_size));
+    for (std::int32_t batch_index = 0; batch_index < batch_size; ++batch_index)
+    {
+        auto& results = batch_results_.at(static_cast<std::size_t>(batch_index));
+        results.resize(output_tensors_.size());
+        std::transform(
+            output_tensors_.cbegin(),
+            output_tensors_.cend(),
+            results.begin(),
+            [batch_size, batch_index](const auto& blob) { return GetBatchSlice(blob, batch_size, batch_index); });
+    }
 }
 
 }  // namespace perception
@@ -0,0 +1,123 @@
+///
+/// @file
+/// @copyright Copyright (c) 2023. MIT License
+///
+#include "perception/inference_engine/shared_inference_engine.h"
+
+#include "perception/common/logging.h"
+
+#include <utility>
+
+namespace perception
+{
+
+SharedInferenceEngine::SharedInferenceEngine(std::shared_ptr<SharedModel> model)
+    : model_{std::move(model)}, initialised_{false}, batch_results_(1U), stage_latencies_{}
+{
+    CHECK(model_ != nullptr) << "Received invalid shared model.";
+    CHECK(model_->engine != nullptr) << "Received invalid inference engine.";
+}
+
+void SharedInferenceEngine::Init()
+{
+    if (initialised_)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock{model_->mutex};
+    if (model_->number_of_users == 0)
+    {
+        model_->engine->Init();
+    }
+    ++model_->number_of_users;
+    initialised_ = true;
+}
+
+void SharedInferenceEngine::Execute(const Image& image)
+{
+    std::lock_guard<std::mutex> lock{model_->mutex};
+    model_->engine->Execute(image);
+    UpdateOutputs();
+}
+
+void SharedInferenceEngine::ExecuteBatch(const std::vector<Image>& images)
+{
+    std::lock_guard<std::mutex> lock{model_->mutex};
+    model_->engine->ExecuteBatch(images);
+    UpdateOutputs();
+}
+
+void SharedInferenceEngine::Shutdown()
+{
+    if (!initialised_)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock{model_->mutex};
+    --model_->number_of_users;
+    if (model_->number_of_users == 0)
+    {
+        model_->engine->Shutdown();
+    }
+    initialised_ = false;
+}
+
+const std::vector<cv::Mat>& SharedInferenceEngine::GetResults() const
+{
+    return batch_results_.front();
+}
+
+const std::vector<std::vector<cv::Mat>>& SharedInferenceEngine::GetBatchResults() const
+{
+    return batch_results_;
+}
+
+const InputTensorInfo& SharedInferenceEngine::GetInputTensorInfo() const
+{
+    return model_->engine->GetInputTensorInfo();
+}
+
+const WarmUpStatistics& SharedInferenceEngine::GetWarmUpStatistics() const
+{
+    return model_->engine->GetWarmUpStatistics();
+}
+
+const InferenceStageLatencies& SharedInferenceEngine::GetStageLatencies() const
+{
+    return stage_latencies_;
+}
+
+bool SharedInferenceEngine::IsBatchingSupported() const
+{
+    return model_->engine->IsBatchingSupported();
+}
+
+void SharedInferenceEngine::UpdateOutputs()
+{
+    stage_latencies_ = model_->engine->GetStageLatencies();
+    const auto& model_batch_results = model_->engine->GetBatchResults();
+
+    // single user is the only one executing the model, hence results are provided as views on the model's outputs
+    if (model_->number_of_users <= 1)
+    {
+        batch_results_ = model_batch_results;
+        return;
+    }
+
+    batch_results_.resize(model_batch_results.size());
+    for (std::size_t index = 0U; index < model_batch_results.size(); ++index)
+    {
+        const auto& model_results = model_batch_results.at(index);
+        auto& results = batch_results_.at(index);
+        results.resize(model_results.size());
+        for (std::size_t output = 0U; output < model_results.size(); ++output)
+        {
+            // reallocates only if output shape/type changes
+            model_results.at(output).copyTo(results.at(output));
+        }
+    }
+}
+
+}  // namespace perception
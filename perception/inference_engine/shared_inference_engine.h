@@ -0,0 +1,108 @@
+///
+/// @file
+/// @copyright Copyright (c) 2023. MIT License
+///
+#ifndef PERCEPTION_INFERENCE_ENGINE_SHARED_INFERENCE_ENGINE_H
+#define PERCEPTION_INFERENCE_ENGINE_SHARED_INFERENCE_ENGINE_H
+
+#include "perception/inference_engine/i_inference_engine.h"
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace perception
+{
+/// @brief Loaded model, shared by all the execution contexts created for it
+struct SharedModel
+{
+    /// @brief Inference Engine holding the loaded model
+    InferenceEnginePtr engine;
+
+    /// @brief Serializes execution of the model (backends are not guaranteed to be re-entrant)
+    std::mutex mutex;
+
+    /// @brief Number of initialised execution contexts
+    std::int32_t number_of_users{0};
+};
+
+/// @brief Execution context of a shared model (see InferenceEnginePool). Model is loaded once and executed by one
+/// context at a time, while each context owns its results, hence contexts can be used from different threads.
+///
+/// @note Results are copied only if the model is shared by more than one initialised context. A single context gets
+///       views on the model's outputs (as for a non-shared Inference Engine), which are invalidated by the next
+///       execution of the model, i.e. also by contexts initialised later.
+class SharedInferenceEngine final : public IInferenceEngine
+{
+  public:
+    /// @brief Constructor
+    ///
+    /// @param model [in] Shared model to be executed
+    explicit SharedInferenceEngine(std::shared_ptr<SharedModel> model);
+
+    /// @brief Initialise model (only for the first context)
+    void Init() override;
+
+    /// @brief Execute Inference with shared model
+    ///
+    /// @param image [in] Image to be fed as input to Inference Engine
+    void Execute(const Image& image) override;
+
+    /// @brief Execute Inference with shared model for a batch of images
+    ///
+    /// @param images [in] Images to be fed as input to Inference Engine
+    void ExecuteBatch(const std::vector<Image>& images) override;
+
+    /// @brief Release model (only for the last context)
+    void Shutdown() override;
+
+    /// @brief Provide results of this context (valid until next call to Execute on this context)
+    ///
+    /// @return List of results (aka cv::Mat) for requested outputs
+    const std::vector<cv::Mat>& GetResults() const override;
+
+    /// @brief Provide results for each image of the last batch executed on this context
+    ///
+    /// @return List of results per image (will be in same order as images provided to ExecuteBatch)
+    const std::vector<std::vector<cv::Mat>>& GetBatchResults() const override;
+
+    /// @brief Provide input tensor expected by the shared model
+    ///
+    /// @return Input size, channels and element type
+    const InputTensorInfo& GetInputTensorInfo() const override;
+
+    /// @brief Provide latencies measured while warming up the shared model (during the first Init)
+    ///
+    /// @return Warm-up statistics (zero iterations, if warm-up is disabled)
+    const WarmUpStatistics& GetWarmUpStatistics() const override;
+
+    /// @brief Provide latencies of the stages of the last inference executed on this context
+    ///
+    /// @return Stage latencies
+    const InferenceStageLatencies& GetStageLatencies() const override;
+
+    /// @brief Provide whether the shared model accepts more than one image per ExecuteBatch call
+    ///
+    /// @return True, if ExecuteBatch accepts more than one image
+    bool IsBatchingSupported() const override;
+
+  private:
+    /// @brief Provide results of the shared model as views (single context) or copy them into the context's results
+    /// (buffers are reused)
+    void UpdateOutputs();
+
+    /// @brief Shared model
+    std::shared_ptr<SharedModel> model_;
+
+    /// @brief Context is initialised (i.e. counted as user of the model)
+    bool initialised_;
+
+    /// @brief Output Tensors saved as cv::Mat for each image of the batch (owned by this context, if model is shared)
+    std::vector<std::vector<cv::Mat>> batch_results_;
+
+    /// @brief Latencies of the stages of the last inference executed on this context
+    InferenceStageLatencies stage_latencies_;
+};
+}  // namespace perception
+#endif  /// PERCEPTION_INFERENCE_ENGINE_SHARED_INFERENCE_ENGINE_H
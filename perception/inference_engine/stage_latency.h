@@ -0,0 +1,25 @@
+///
+/// @file
+/// @copyright Copyright (c) 2023. MIT License
+///
+#ifndef PERCEPTION_INFERENCE_ENGINE_STAGE_LATENCY_H
+#define PERCEPTION_INFERENCE_ENGINE_STAGE_LATENCY_H
+
+#include <chrono>
+
+namespace perception
+{
+/// @brief Invoke provided callable (i.e. inference stage) and store its latency
+///
+/// @param latency [out] - Measured latency
+/// @param callable [in] - Callable to be measured
+template <typename Callable>
+void MeasureLatency(std::chrono::microseconds& latency, Callable&& callable)
+{
+    const auto start = std::chrono::steady_clock::now();
+    callable();
+    latency = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+}
+}  // namespace perception
+
+#endif  /// PERCEPTION_INFERENCE_ENGINE_STAGE_LATENCY_H
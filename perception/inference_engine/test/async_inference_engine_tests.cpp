@@ -0,0 +1,156 @@
+///
+/// @file
+/// @copyright Copyright (c) 2023. MIT License
+///
+#include "perception/inference_engine/async_inference_engine.h"
+#include "perception/inference_engine/test/support/mocks/inference_engine_mock.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <vector>
+
+namespace perception
+{
+namespace
+{
+using ::testing::_;
+using ::testing::AllOf;
+using ::testing::Field;
+using ::testing::Invoke;
+using ::testing::ReturnRef;
+
+class AsyncInferenceEngineFixture : public ::testing::Test
+{
+  public:
+    AsyncInferenceEngineFixture()
+        : image_{4, 4, CV_8UC3, cv::Scalar::all(0)},
+          input_tensor_info_{},
+          results_{cv::Mat{1, 1, CV_32FC1, cv::Scalar::all(0.0F)}},
+          engine_{},
+          unit_{}
+    {
+        ON_CALL(engine_, GetInputTensorInfo()).WillByDefault(ReturnRef(input_tensor_info_));
+        ON_CALL(engine_, GetResults()).WillByDefault(ReturnRef(results_));
+    }
+
+  protected:
+    void CreateUnit()
+    {
+        unit_ = std::make_unique<AsyncInferenceEngine>(engine_);
+        unit_->Init();
+    }
+
+    /// @brief Let each Execute write the number of the executed frame (1, 2, ...) to the engine's results
+    void NumberExecutedFrames()
+    {
+        ON_CALL(engine_, Execute(_)).WillByDefault(Invoke([this](const Image&) {
+            results_.front().at<float>(0, 0) += 1.0F;
+        }));
+    }
+
+    const Image image_;
+    InputTensorInfo input_tensor_info_;
+    std::vector<cv::Mat> results_;
+    ::testing::NiceMock<test::support::InferenceEngineMock> engine_;
+    std::unique_ptr<AsyncInferenceEngine> unit_;
+};
+
+TEST_F(AsyncInferenceEngineFixture, Submit_GivenConsecutiveFrames_ExpectResultsPerFrame)
+{
+    // Given
+    NumberExecutedFrames();
+    EXPECT_CALL(engine_, Execute(_)).Times(3);
+    CreateUnit();
+
+    // When
+    auto first_frame = unit_->Submit(image_);
+    auto second_frame = unit_->Submit(image_);
+    const auto first_frame_number = first_frame.get().front().at<float>(0, 0);
+    const auto& second_frame_results = second_frame.get();
+    auto third_frame = unit_->Submit(image_);
+    const auto& third_frame_results = third_frame.get();
+
+    // Then
+    EXPECT_FLOAT_EQ(first_frame_number, 1.0F);
+    EXPECT_FLOAT_EQ(second_frame_results.front().at<float>(0, 0), 2.0F);
+    EXPECT_FLOAT_EQ(third_frame_results.front().at<float>(0, 0), 3.0F);
+    EXPECT_NE(&second_frame_results, &third_frame_results);
+}
+
+TEST_F(AsyncInferenceEngineFixture, Submit_GivenModelInputSize_ExpectResizedImageExecuted)
+{
+    // Given
+    input_tensor_info_.size = cv::Size{2, 2};
+    EXPECT_CALL(engine_, Execute(AllOf(Field(&Image::rows, 2), Field(&Image::cols, 2)))).Times(1);
+    CreateUnit();
+
+    // When
+    auto frame = unit_->Submit(image_);
+
+    // Then
+    EXPECT_EQ(frame.get().size(), results_.size());
+}
+
+TEST_F(AsyncInferenceEngineFixture, Submit_GivenRunningInference_ExpectNonBlockingSubmission)
+{
+    // Given
+    std::promise<void> release_inference{};
+    auto inference_released = release_inference.get_future().share();
+    EXPECT_CALL(engine_, Execute(_))
+        .WillOnce(Invoke([inference_released](const Image&) { inference_released.wait(); }))
+        .WillOnce(Invoke([](const Image&) {}));
+    CreateUnit();
+
+    // When
+    auto first_frame = unit_->Submit(image_);
+    auto second_frame = unit_->Submit(image_);
+
+    // Then
+    EXPECT_EQ(first_frame.wait_for(std::chrono::milliseconds{10}), std::future_status::timeout);
+    EXPECT_EQ(second_frame.wait_for(std::chrono::milliseconds{10}), std::future_status::timeout);
+
+    release_inference.set_value();
+    EXPECT_EQ(first_frame.get().size(), results_.size());
+    EXPECT_EQ(second_frame.get().size(), results_.size());
+}
+
+TEST_F(AsyncInferenceEngineFixture, Wait_GivenPendingFrames_ExpectCompletedFrames)
+{
+    // Given
+    EXPECT_CALL(engine_, Execute(_)).Times(2);
+    CreateUnit();
+    auto first_frame = unit_->Submit(image_);
+    auto second_frame = unit_->Submit(image_);
+
+    // When
+    unit_->Wait();
+
+    // Then
+    EXPECT_EQ(first_frame.wait_for(std::chrono::seconds::zero()), std::future_status::ready);
+    EXPECT_EQ(second_frame.wait_for(std::chrono::seconds::zero()), std::future_status::ready);
+    unit_->Shutdown();
+}
+
+TEST_F(AsyncInferenceEngineFixture, Shutdown_GivenPendingFrames_ExpectCompletedFramesAndEngineNotReleased)
+{
+    // Given
+    EXPECT_CALL(engine_, Execute(_)).Times(2);
+    EXPECT_CALL(engine_, Shutdown()).Times(0);
+    CreateUnit();
+    auto first_frame = unit_->Submit(image_);
+    auto second_frame = unit_->Submit(image_);
+
+    // When
+    unit_->Shutdown();
+
+    // Then
+    EXPECT_EQ(first_frame.wait_for(std::chrono::seconds::zero()), std::future_status::ready);
+    EXPECT_EQ(second_frame.wait_for(std::chrono::seconds::zero()), std::future_status::ready);
+}
+
+}  // namespace
+}  // namespace perception
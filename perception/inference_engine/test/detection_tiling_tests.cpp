@@ -0,0 +1,124 @@
+///
+/// @file
+/// @copyright Copyright (c) 2023. MIT License
+///
+#include "perception/inference_engine/detection_tiling.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <opencv4/opencv2/core.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace perception
+{
+namespace
+{
+/// @brief Provide SSD results for a tile, with one detection per given box ([ymin, xmin, ymax, xmax])
+std::vector<cv::Mat> GetTileResults(const float label,
+                                    const std::vector<float>& scores,
+                                    const std::vector<cv::Vec4f>& boxes)
+{
+    constexpr std::int32_t kMaxDetections{10};
+    std::vector<cv::Mat> results{cv::Mat::zeros(kMaxDetections, 1, CV_32F),
+                                 cv::Mat::zeros(kMaxDetections, 1, CV_32F),
+                                 cv::Mat::zeros(kMaxDetections, 4, CV_32F),
+                                 cv::Mat::zeros(1, 1, CV_32F)};
+    for (std::size_t index = 0U; index < boxes.size(); ++index)
+    {
+        const auto idx = static_cast<std::int32_t>(index);
+        results.at(kDetectionClassesIndex).at<float>(idx, 0) = label;
+        results.at(kDetectionScoresIndex).at<float>(idx, 0) = scores.at(index);
+        for (std::int32_t coordinate = 0; coordinate < 4; ++coordinate)
+        {
+            results.at(kDetectionBoxesIndex).at<float>(idx, coordinate) = boxes.at(index)[coordinate];
+        }
+    }
+    results.at(kNumDetectionsIndex).at<float>(0, 0) = static_cast<float>(boxes.size());
+    return results;
+}
+
+TEST(DetectionTilingTest, IsTilingEnabled_GivenDefaultParameters_ExpectDisabled)
+{
+    // Given
+    const TilingParameters tiling_parameters{};
+
+    // When
+    const auto enabled = IsTilingEnabled(tiling_parameters);
+
+    // Then
+    EXPECT_FALSE(enabled);
+}
+
+TEST(DetectionTilingTest, GetTiles_GivenOverlappingColumns_ExpectEqualTilesCoveringImage)
+{
+    // Given
+    TilingParameters tiling_parameters{};
+    tiling_parameters.number_of_columns = 3;
+    tiling_parameters.overlap = 0.25F;
+
+    // When
+    const auto tiles = GetTiles(cv::Size{1000, 400}, tiling_parameters);
+
+    // Then
+    EXPECT_THAT(tiles,
+                ::testing::ElementsAre(
+                    cv::Rect{0, 0, 400, 400}, cv::Rect{300, 0, 400, 400}, cv::Rect{600, 0, 400, 400}));
+}
+
+TEST(DetectionTilingTest, GetTiles_GivenHorizonBand_ExpectTilesWithinRegionOfInterest)
+{
+    // Given
+    TilingParameters tiling_parameters{};
+    tiling_parameters.region_of_interest = cv::Rect2f{0.0F, 0.25F, 1.0F, 0.5F};
+    tiling_parameters.number_of_columns = 2;
+    tiling_parameters.overlap = 0.0F;
+
+    // When
+    const auto tiles = GetTiles(cv::Size{1920, 1080}, tiling_parameters);
+
+    // Then
+    EXPECT_THAT(tiles, ::testing::ElementsAre(cv::Rect{0, 270, 960, 540}, cv::Rect{960, 270, 960, 540}));
+}
+
+TEST(DetectionTilingTest, MergeDetections_GivenTileDetection_ExpectBoxInFrameCoordinates)
+{
+    // Given
+    const std::vector<cv::Rect> tiles{cv::Rect{0, 0, 100, 100}, cv::Rect{100, 0, 100, 100}};
+    const std::vector<std::vector<cv::Mat>> tile_results{
+        GetTileResults(1.0F, {}, {}), GetTileResults(1.0F, {0.9F}, {cv::Vec4f{0.5F, 0.0F, 1.0F, 0.5F}})};
+    std::vector<cv::Mat> results{};
+
+    // When
+    MergeDetections(tile_results, tiles, cv::Size{200, 100}, 0.5F, results);
+
+    // Then
+    ASSERT_EQ(results.size(), 4U);
+    EXPECT_EQ(results.at(kNumDetectionsIndex).at<float>(0, 0), 1.0F);
+    EXPECT_EQ(results.at(kDetectionScoresIndex).at<float>(0, 0), 0.9F);
+    const auto& boxes = results.at(kDetectionBoxesIndex);
+    EXPECT_FLOAT_EQ(boxes.at<float>(0, 0), 0.5F);
+    EXPECT_FLOAT_EQ(boxes.at<float>(0, 1), 0.5F);
+    EXPECT_FLOAT_EQ(boxes.at<float>(0, 2), 1.0F);
+    EXPECT_FLOAT_EQ(boxes.at<float>(0, 3), 0.75F);
+}
+
+TEST(DetectionTilingTest, MergeDetections_GivenDuplicateFromOverlappingTiles_ExpectHighestScoreKept)
+{
+    // Given
+    const std::vector<cv::Rect> tiles{cv::Rect{0, 0, 100, 100}, cv::Rect{50, 0, 100, 100}};
+    const std::vector<std::vector<cv::Mat>> tile_results{
+        GetTileResults(1.0F, {0.6F}, {cv::Vec4f{0.0F, 0.6F, 0.5F, 0.8F}}),
+        GetTileResults(1.0F, {0.8F}, {cv::Vec4f{0.0F, 0.1F, 0.5F, 0.3F}})};
+    std::vector<cv::Mat> results{};
+
+    // When
+    MergeDetections(tile_results, tiles, cv::Size{150, 100}, 0.5F, results);
+
+    // Then
+    EXPECT_EQ(results.at(kNumDetectionsIndex).at<float>(0, 0), 1.0F);
+    EXPECT_EQ(results.at(kDetectionScoresIndex).at<float>(0, 0), 0.8F);
+}
+}  // namespace
+}  // namespace perception
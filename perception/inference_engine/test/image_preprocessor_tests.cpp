@@ -0,0 +1,150 @@
+///
+/// @file
+/// @copyright Copyright (c) 2023. MIT License
+///
+#include "perception/inference_engine/image_preprocessor.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <opencv4/opencv2/core.hpp>
+#include <opencv4/opencv2/imgproc.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace perception
+{
+namespace
+{
+TEST(ImagePreprocessorTest, Preprocess_GivenNormalization_ExpectNormalizedPixels)
+{
+    // Given
+    const Image image{480, 640, CV_8UC3, cv::Scalar::all(255)};
+    std::vector<float> output(300U * 300U * 3U);
+    ImagePreprocessor unit{TensorLayout::kNHWC, true};
+
+    // When
+    unit.Preprocess(image, cv::Size{300, 300}, 1.0F / 127.5F, -1.0F, output.data());
+
+    // Then
+    EXPECT_THAT(output, ::testing::Each(::testing::FloatNear(1.0F, 1e-5F)));
+}
+
+TEST(ImagePreprocessorTest, Preprocess_GivenDifferentImageGeometry_ExpectResizedPixels)
+{
+    // Given
+    const Image first_image{480, 640, CV_8UC3, cv::Scalar::all(10)};
+    const Image second_image{720, 1280, CV_8UC3, cv::Scalar::all(10)};
+    std::vector<std::uint8_t> output(300U * 300U * 3U);
+    ImagePreprocessor unit{TensorLayout::kNHWC, true};
+
+    // When
+    unit.Preprocess(first_image, cv::Size{300, 300}, 1.0F, 0.0F, output.data());
+    unit.Preprocess(second_image, cv::Size{300, 300}, 1.0F, 0.0F, output.data());
+    unit.Preprocess(first_image, cv::Size{300, 300}, 1.0F, 0.0F, output.data());
+
+    // Then
+    EXPECT_THAT(output, ::testing::Each(10U));
+}
+
+TEST(ImagePreprocessorTest, Preprocess_GivenInt8Quantization_ExpectSaturatedPixels)
+{
+    // Given
+    const Image image{480, 640, CV_8UC3, cv::Scalar::all(255)};
+    std::vector<std::int8_t> output(300U * 300U * 3U);
+    ImagePreprocessor unit{TensorLayout::kNHWC, true};
+
+    // When
+    unit.Preprocess(image, cv::Size{300, 300}, 1.0F, -128.0F, output.data());
+
+    // Then
+    EXPECT_THAT(output, ::testing::Each(127));
+}
+
+TEST(ImagePreprocessorTest, Preprocess_GivenBgrImage_ExpectRgbPixels)
+{
+    // Given
+    const Image image{4, 4, CV_8UC3, cv::Scalar{1, 2, 3}};
+    std::vector<std::uint8_t> output(2U * 2U * 3U);
+    ImagePreprocessor unit{TensorLayout::kNHWC, true};
+
+    // When
+    unit.Preprocess(image, cv::Size{2, 2}, 1.0F, 0.0F, output.data());
+
+    // Then
+    EXPECT_THAT(output, ::testing::ElementsAre(3U, 2U, 1U, 3U, 2U, 1U, 3U, 2U, 1U, 3U, 2U, 1U));
+}
+
+TEST(ImagePreprocessorTest, Preprocess_GivenNchwLayout_ExpectChannelPlanes)
+{
+    // Given
+    const Image image{4, 4, CV_8UC3, cv::Scalar{1, 2, 3}};
+    std::vector<float> output(2U * 2U * 3U);
+    ImagePreprocessor unit{TensorLayout::kNCHW, false};
+
+    // When
+    unit.Preprocess(image, cv::Size{2, 2}, 1.0F, 0.0F, output.data());
+
+    // Then
+    EXPECT_THAT(output, ::testing::ElementsAre(1.0F, 1.0F, 1.0F, 1.0F, 2.0F, 2.0F, 2.0F, 2.0F, 3.0F, 3.0F, 3.0F, 3.0F));
+}
+
+TEST(ImagePreprocessorTest, Preprocess_GivenSameGeometry_ExpectUnchangedPixels)
+{
+    // Given
+    Image image{2, 3, CV_8UC1, cv::Scalar::all(0)};
+    for (std::int32_t row = 0; row < image.rows; ++row)
+    {
+        for (std::int32_t col = 0; col < image.cols; ++col)
+        {
+            image.ptr<std::uint8_t>(row)[col] = static_cast<std::uint8_t>((row * image.cols) + col);
+        }
+    }
+    std::vector<std::uint8_t> output(2U * 3U);
+    ImagePreprocessor unit{TensorLayout::kNHWC, true};
+
+    // When
+    unit.Preprocess(image, image.size(), 1.0F, 0.0F, output.data());
+
+    // Then
+    EXPECT_THAT(output, ::testing::ElementsAre(0U, 1U, 2U, 3U, 4U, 5U));
+}
+
+TEST(ImagePreprocessorTest, Preprocess_GivenUpscaling_ExpectBilinearInterpolation)
+{
+    // Given
+    Image image{1, 2, CV_8UC1, cv::Scalar::all(0)};
+    image.ptr<std::uint8_t>(0)[1] = 100U;
+    std::vector<float> output(4U);
+    ImagePreprocessor unit{TensorLayout::kNHWC, false};
+
+    // When
+    unit.Preprocess(image, cv::Size{4, 1}, 1.0F, 0.0F, output.data());
+
+    // Then
+    EXPECT_THAT(output, ::testing::ElementsAre(0.0F, 25.0F, 75.0F, 100.0F));
+}
+
+TEST(ImagePreprocessorTest, Preprocess_GivenRandomImage_ExpectSameAsOpenCVResize)
+{
+    // Given (output width not a multiple of the SIMD width, so that vector and scalar tail are both covered)
+    Image image{123, 171, CV_8UC3};
+    cv::randu(image, cv::Scalar::all(0), cv::Scalar::all(255));
+    const cv::Size size{37, 23};
+    std::vector<float> output(static_cast<std::size_t>(size.area()) * 3U);
+    ImagePreprocessor unit{TensorLayout::kNHWC, false};
+
+    // When
+    unit.Preprocess(image, size, 1.0F, 0.0F, output.data());
+
+    // Then (cv::resize interpolates 8-bit images in fixed-point arithmetic, hence rounded to the nearest pixel value)
+    Image expected{};
+    cv::resize(image, expected, size, 0.0, 0.0, cv::INTER_LINEAR);
+    ASSERT_TRUE(expected.isContinuous());
+    for (std::size_t index = 0U; index < output.size(); ++index)
+    {
+        EXPECT_NEAR(output[index], static_cast<float>(expected.data[index]), 1.0F) << "at index " << index;
+    }
+}
+}  // namespace
+}  // namespace perception
@@ -0,0 +1,201 @@
+///
+/// @file
+/// @brief Counts heap allocations made by the engine-owned code of warmed-up inference engines (allocations made by the
+/// backend runtimes are not counted). Replaces the global operator new/delete, hence kept in its own test binary.
+/// @copyright Copyright (c) 2023. MIT License
+///
+#include "perception/inference_engine/detection_tiling.h"
+#include "perception/inference_engine/i_inference_engine.h"
+#include "perception/inference_engine/null_inference_engine.h"
+#include "perception/inference_engine/onnxruntime_inference_engine.h"
+#include "perception/inference_engine/opencv_inference_engine.h"
+#include "perception/inference_engine/test/support/inference_engine_parameters.h"
+#include "perception/inference_engine/tf_inference_engine.h"
+#include "perception/inference_engine/tflite_inference_engine.h"
+#include "perception/inference_engine/torch_inference_engine.h"
+
+#include <gtest/gtest.h>
+#include <opencv4/opencv2/core.hpp>
+#include <opencv4/opencv2/imgcodecs.hpp>
+
+#include <dlfcn.h>
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+namespace
+{
+/// @brief Enable counting of heap allocations
+std::atomic<bool> count_allocations{false};
+
+/// @brief Base address of the shared object containing the engine-owned code (i.e. perception/inference_engine)
+std::atomic<const void*> engine_object{nullptr};
+
+/// @brief Base address of the test executable
+std::atomic<const void*> test_object{nullptr};
+
+/// @brief Number of heap allocations, while counting is enabled
+std::atomic<std::int64_t> number_of_allocations{0};
+
+/// @brief Number of heap allocations made by engine-owned code, while counting is enabled
+std::atomic<std::int64_t> number_of_engine_allocations{0};
+
+/// @brief Number of heap deallocations, while counting is enabled
+std::atomic<std::int64_t> number_of_deallocations{0};
+
+/// @brief Provide base address of the shared object (or executable) containing the given code address
+///
+/// @param address [in] Code address
+///
+/// @return Base address (nullptr, if unknown)
+const void* GetObjectBase(const void* address)
+{
+    Dl_info info{};
+    return (dladdr(address, &info) != 0) ? info.dli_fbase : nullptr;
+}
+
+/// @brief Provide whether the allocation is made by engine-owned code, i.e. its caller resides in the engine library
+/// or in the test executable (e.g. inlined standard library templates instantiated in both), rather than in a backend
+/// runtime (TensorFlow, TFLite, Torch, OpenCV, ONNX Runtime)
+///
+/// @param caller [in] Return address of the allocation
+///
+/// @return True, if caller is engine-owned code
+///
+/// @note Allocations made on behalf of the engine by non-inline library functions (e.g. std::string growth in
+/// libstdc++) are not attributed to the engine.
+bool IsEngineOwned(const void* caller)
+{
+    const auto* object = GetObjectBase(caller);
+    return (object != nullptr) && ((object == engine_object.load()) || (object == test_object.load()));
+}
+}  // namespace
+
+void* operator new(std::size_t size)
+{
+    if (count_allocations.load(std::memory_order_relaxed))
+    {
+        number_of_allocations.fetch_add(1, std::memory_order_relaxed);
+        if (IsEngineOwned(__builtin_return_address(0)))
+        {
+            number_of_engine_allocations.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    void* ptr = std::malloc((size == 0U) ? 1U : size);
+    if (ptr == nullptr)
+    {
+        throw std::bad_alloc{};
+    }
+    return ptr;
+}
+
+void operator delete(void* ptr) noexcept
+{
+    if ((ptr != nullptr) && count_allocations.load(std::memory_order_relaxed))
+    {
+        number_of_deallocations.fetch_add(1, std::memory_order_relaxed);
+    }
+    std::free(ptr);
+}
+
+namespace perception
+{
+namespace
+{
+/// @brief Number of frames executed while counting heap allocations
+constexpr std::int32_t kNumberOfFrames{10};
+
+/// @brief Engines, whose own code does not allocate while executing a warmed-up model (i.e. input and outputs are
+/// preallocated views). All other engines create tensors for each frame, hence only their memory must not grow across
+/// frames.
+template <typename T>
+struct IsAllocationFree : std::false_type
+{
+};
+
+template <>
+struct IsAllocationFree<NullInferenceEngine> : std::true_type
+{
+};
+
+template <>
+struct IsAllocationFree<TFLiteInferenceEngine> : std::true_type
+{
+};
+
+template <>
+struct IsAllocationFree<OnnxRuntimeInferenceEngine> : std::true_type
+{
+};
+
+template <typename T>
+class InferenceEngineAllocationFixture : public ::testing::Test
+{
+  public:
+    InferenceEngineAllocationFixture()
+        : image_{cv::imread("data/messi5.jpg", cv::IMREAD_COLOR)},
+          unit_{std::make_unique<T>(test::support::GetInferenceEngineParameter<T>())}
+    {
+    }
+
+  protected:
+    void SetUp() override
+    {
+        engine_object.store(GetObjectBase(reinterpret_cast<const void*>(&IsTilingEnabled)));
+        test_object.store(GetObjectBase(reinterpret_cast<const void*>(&GetObjectBase)));
+        unit_->Init();
+
+        // first frame allocates tensors for the image geometry
+        unit_->Execute(image_);
+    }
+    void TearDown() override { unit_->Shutdown(); }
+
+    void RunFramesCountingAllocations()
+    {
+        number_of_allocations.store(0);
+        number_of_engine_allocations.store(0);
+        number_of_deallocations.store(0);
+        count_allocations.store(true);
+        for (std::int32_t frame = 0; frame < kNumberOfFrames; ++frame)
+        {
+            unit_->Execute(image_);
+        }
+        count_allocations.store(false);
+    }
+
+  private:
+    const Image image_;
+    InferenceEnginePtr unit_;
+};
+TYPED_TEST_SUITE_P(InferenceEngineAllocationFixture);
+
+TYPED_TEST_P(InferenceEngineAllocationFixture, Execute_GivenWarmedUpEngine_ExpectNoGrowingHeapAllocations)
+{
+    // When
+    this->RunFramesCountingAllocations();
+
+    // Then
+    EXPECT_EQ(number_of_allocations.load(), number_of_deallocations.load());
+    if (IsAllocationFree<TypeParam>::value)
+    {
+        EXPECT_EQ(number_of_engine_allocations.load(), 0);
+    }
+}
+
+REGISTER_TYPED_TEST_SUITE_P(InferenceEngineAllocationFixture,
+                            Execute_GivenWarmedUpEngine_ExpectNoGrowingHeapAllocations);
+
+typedef ::testing::Types<TFInferenceEngine,
+                         TFLiteInferenceEngine,
+                         OpenCVInferenceEngine,
+                         TorchInferenceEngine,
+                         OnnxRuntimeInferenceEngine,
+                         NullInferenceEngine>
+    InferenceEngineTestTypes;
+INSTANTIATE_TYPED_TEST_SUITE_P(InferenceEngine, InferenceEngineAllocationFixture, InferenceEngineTestTypes);
+}  // namespace
+}  // namespace perception
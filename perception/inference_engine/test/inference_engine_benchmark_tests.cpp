@@ -0,0 +1,236 @@
+///
+/// @file
+/// @copyright Copyright (c) 2023. MIT License.
+///
+#include "perception/inference_engine/i_inference_engine.h"
+#include "perception/inference_engine/image_preprocessor.h"
+#include "perception/inference_engine/test/support/inference_engine_parameters.h"
+
+#include <benchmark/benchmark.h>
+#include <opencv4/opencv2/core.hpp>
+#include <opencv4/opencv2/dnn.hpp>
+#include <opencv4/opencv2/imgcodecs.hpp>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <vector>
+
+namespace perception
+{
+namespace
+{
+/// @brief Largest benchmarked batch size (batch sizes 1..kMaxBatchSize)
+constexpr std::int64_t kMaxBatchSize{8};
+
+/// @brief Provide current resident set size of the process
+///
+/// @note Unlike the peak RSS (getrusage), this decreases again once memory is returned to the system, hence the
+/// difference around loading a model is attributable to this model. Memory freed by previous benchmarks but kept by
+/// the allocator may be reused, hence run a single backend (--benchmark_filter) for exact figures.
+///
+/// @return Current RSS (in KiB)
+double GetResidentSetSize()
+{
+    std::ifstream statm{"/proc/self/statm"};
+    std::int64_t size_pages{0};
+    std::int64_t resident_pages{0};
+    statm >> size_pages >> resident_pages;
+    return static_cast<double>(resident_pages * sysconf(_SC_PAGESIZE)) / 1024.0;
+}
+
+template <typename T>
+class InferenceEngineBenchmarkFixture : public ::benchmark::Fixture
+{
+  public:
+    InferenceEngineBenchmarkFixture()
+        : image_{cv::imread("data/grace_hopper.jpg", cv::IMREAD_COLOR)},
+          unit_{},
+          rss_before_init_kib_{0.0},
+          rss_after_init_kib_{0.0}
+    {
+    }
+
+  protected:
+    void SetUp(const benchmark::State& /* state */) override
+    {
+        rss_before_init_kib_ = GetResidentSetSize();
+        unit_ = std::make_unique<T>(test::support::GetInferenceEngineParameter<T>());
+        unit_->Init();
+        rss_after_init_kib_ = GetResidentSetSize();
+    }
+    void TearDown(const benchmark::State& /* state */) override
+    {
+        unit_->Shutdown();
+        unit_.reset();
+    }
+
+    /// @brief Report model name (backends do not all run the same model) and the memory attributable to the engine,
+    /// i.e. the RSS growth by loading the model and by executing it
+    void ReportModelAndMemory(benchmark::State& state) const
+    {
+        state.SetLabel(test::support::GetModelName<T>());
+        state.counters["model_rss_kib"] = rss_after_init_kib_ - rss_before_init_kib_;
+        state.counters["total_rss_kib"] = GetResidentSetSize() - rss_before_init_kib_;
+    }
+
+    void RunBenchmarkTest(benchmark::State& state)
+    {
+        if ((state.range(0) > 1) && !unit_->IsBatchingSupported())
+        {
+            state.SkipWithError("Model does not support batching");
+            return;
+        }
+        const std::vector<Image> images(static_cast<std::size_t>(state.range(0)), image_);
+
+        // first run allocates tensors for the batch size
+        unit_->ExecuteBatch(images);
+
+        InferenceStageLatencies total_latencies{};
+        for (auto _ : state)
+        {
+            unit_->ExecuteBatch(images);
+
+            const auto& stage_latencies = unit_->GetStageLatencies();
+            total_latencies.preprocess += stage_latencies.preprocess;
+            total_latencies.invoke += stage_latencies.invoke;
+            total_latencies.postprocess += stage_latencies.postprocess;
+        }
+
+        // throughput (images per second) and mean latency per stage (per batch)
+        const auto average = [](const std::chrono::microseconds total_latency) {
+            return benchmark::Counter(static_cast<double>(total_latency.count()), benchmark::Counter::kAvgIterations);
+        };
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+        state.counters["preprocess_us"] = average(total_latencies.preprocess);
+        state.counters["invoke_us"] = average(total_latencies.invoke);
+        state.counters["postprocess_us"] = average(total_latencies.postprocess);
+        ReportModelAndMemory(state);
+    }
+
+    void RunEndToEndBenchmarkTest(benchmark::State& state)
+    {
+        // first run allocates tensors
+        unit_->Execute(image_);
+
+        for (auto _ : state)
+        {
+            unit_->Execute(image_);
+
+            // consume the detections, as a client would
+            for (const auto& result : unit_->GetResults())
+            {
+                benchmark::DoNotOptimize(result.data);
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations());
+        ReportModelAndMemory(state);
+    }
+
+  private:
+    const Image image_;
+    std::unique_ptr<IInferenceEngine> unit_;
+
+    /// @brief Resident set size before and after loading the model (in KiB)
+    double rss_before_init_kib_;
+    double rss_after_init_kib_;
+};
+
+BENCHMARK_TEMPLATE_DEFINE_F(InferenceEngineBenchmarkFixture, TFInferenceEngine, TFInferenceEngine)
+(benchmark::State& state)
+{
+    RunBenchmarkTest(state);
+}
+BENCHMARK_REGISTER_F(InferenceEngineBenchmarkFixture, TFInferenceEngine)
+    ->DenseRange(1, kMaxBatchSize)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_TEMPLATE_DEFINE_F(InferenceEngineBenchmarkFixture, TFLiteInferenceEngine, TFLiteInferenceEngine)
+(benchmark::State& state)
+{
+    RunBenchmarkTest(state);
+}
+BENCHMARK_REGISTER_F(InferenceEngineBenchmarkFixture, TFLiteInferenceEngine)
+    ->DenseRange(1, kMaxBatchSize)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_TEMPLATE_DEFINE_F(InferenceEngineBenchmarkFixture, TorchInferenceEngine, TorchInferenceEngine)
+(benchmark::State& state)
+{
+    RunBenchmarkTest(state);
+}
+BENCHMARK_REGISTER_F(InferenceEngineBenchmarkFixture, TorchInferenceEngine)
+    ->DenseRange(1, kMaxBatchSize)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_TEMPLATE_DEFINE_F(InferenceEngineBenchmarkFixture, OpenCVInferenceEngine, OpenCVInferenceEngine)
+(benchmark::State& state)
+{
+    RunBenchmarkTest(state);
+}
+BENCHMARK_REGISTER_F(InferenceEngineBenchmarkFixture, OpenCVInferenceEngine)
+    ->DenseRange(1, kMaxBatchSize)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_TEMPLATE_DEFINE_F(InferenceEngineBenchmarkFixture, OnnxRuntimeInferenceEngine, OnnxRuntimeInferenceEngine)
+(benchmark::State& state)
+{
+    RunBenchmarkTest(state);
+}
+BENCHMARK_REGISTER_F(InferenceEngineBenchmarkFixture, OnnxRuntimeInferenceEngine)
+    ->DenseRange(1, kMaxBatchSize)
+    ->Unit(benchmark::kMillisecond);
+
+void ImagePreprocessorBenchmark(benchmark::State& state)
+{
+    const Image image{cv::imread("data/grace_hopper.jpg", cv::IMREAD_COLOR)};
+    const cv::Size input_size{300, 300};
+    std::vector<float> input_tensor(static_cast<std::size_t>(input_size.area() * image.channels()));
+    ImagePreprocessor unit{TensorLayout::kNCHW, true};
+
+    for (auto _ : state)
+    {
+        unit.Preprocess(image, input_size, 1.0F / 127.5F, -1.0F, input_tensor.data());
+        benchmark::DoNotOptimize(input_tensor.data());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(ImagePreprocessorBenchmark)->Unit(benchmark::kMicrosecond);
+
+// previous preprocessing path (OpenCV engine), resize, BGR to RGB, normalization and NCHW conversion by cv::dnn
+void BlobFromImageBenchmark(benchmark::State& state)
+{
+    const Image image{cv::imread("data/grace_hopper.jpg", cv::IMREAD_COLOR)};
+    const cv::Size input_size{300, 300};
+    cv::Mat input_tensor{};
+
+    for (auto _ : state)
+    {
+        cv::dnn::blobFromImage(
+            image, input_tensor, 1.0 / 127.5, input_size, cv::Scalar::all(127.5), true, false, CV_32F);
+        benchmark::DoNotOptimize(input_tensor.data);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BlobFromImageBenchmark)->Unit(benchmark::kMicrosecond);
+
+// end-to-end (single frame) latency of the same SSD model, TFLite flat buffer against TF SavedModel
+BENCHMARK_TEMPLATE_DEFINE_F(InferenceEngineBenchmarkFixture, EndToEnd_TFInferenceEngine, TFInferenceEngine)
+(benchmark::State& state)
+{
+    RunEndToEndBenchmarkTest(state);
+}
+BENCHMARK_REGISTER_F(InferenceEngineBenchmarkFixture, EndToEnd_TFInferenceEngine)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_TEMPLATE_DEFINE_F(InferenceEngineBenchmarkFixture, EndToEnd_TFLiteInferenceEngine, TFLiteInferenceEngine)
+(benchmark::State& state)
+{
+    RunEndToEndBenchmarkTest(state);
+}
+BENCHMARK_REGISTER_F(InferenceEngineBenchmarkFixture, EndToEnd_TFLiteInferenceEngine)->Unit(benchmark::kMillisecond);
+
+}  // namespace
+}  // namespace perception
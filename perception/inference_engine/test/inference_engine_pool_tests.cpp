@@ -0,0 +1,265 @@
+///
+/// @file
+/// @copyright Copyright (c) 2023. MIT License
+///
+#include "perception/inference_engine/inference_engine_pool.h"
+#include "perception/inference_engine/test/support/mocks/inference_engine_mock.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+namespace perception
+{
+namespace
+{
+using ::testing::_;
+using ::testing::ReturnRef;
+
+class InferenceEnginePoolFixture : public ::testing::Test
+{
+  public:
+    InferenceEnginePoolFixture()
+        : image_{4, 4, CV_8UC3, cv::Scalar::all(0)},
+          batch_results_{{cv::Mat{1, 1, CV_32FC1, cv::Scalar::all(1.0F)}}},
+          stage_latencies_{},
+          number_of_created_engines_{0},
+          requested_params_{},
+          unit_{kMaxIntraOpThreads,
+                kMaxInterOpThreads,
+                [this](const InferenceEngineType&, const InferenceEngineParameters& params) {
+                    ++number_of_created_engines_;
+                    requested_params_.push_back(params);
+                    auto engine = std::make_unique<::testing::NiceMock<test::support::InferenceEngineMock>>();
+                    ON_CALL(*engine, GetBatchResults()).WillByDefault(ReturnRef(batch_results_));
+                    ON_CALL(*engine, GetStageLatencies()).WillByDefault(ReturnRef(stage_latencies_));
+                    return engine;
+                }}
+    {
+    }
+
+  protected:
+    static constexpr std::int32_t kMaxIntraOpThreads{4};
+    static constexpr std::int32_t kMaxInterOpThreads{2};
+
+    InferenceEngineParameters GetParameters(const std::string& model_path) const
+    {
+        InferenceEngineParameters params{};
+        params.model_path = model_path;
+        return params;
+    }
+
+    const Image image_;
+    const std::vector<std::vector<cv::Mat>> batch_results_;
+    const InferenceStageLatencies stage_latencies_;
+    std::int32_t number_of_created_engines_;
+    std::vector<InferenceEngineParameters> requested_params_;
+    InferenceEnginePool unit_;
+};
+
+constexpr std::int32_t InferenceEnginePoolFixture::kMaxIntraOpThreads;
+constexpr std::int32_t InferenceEnginePoolFixture::kMaxInterOpThreads;
+
+TEST_F(InferenceEnginePoolFixture, Acquire_GivenSameModel_ExpectSingleLoadedModel)
+{
+    // Given
+    const auto params = GetParameters("model.pb");
+
+    // When
+    auto first_context = unit_.Acquire(InferenceEngineType::kTensorFlow, params);
+    auto second_context = unit_.Acquire(InferenceEngineType::kTensorFlow, params);
+
+    // Then
+    EXPECT_NE(first_context, second_context);
+    EXPECT_EQ(number_of_created_engines_, 1);
+    EXPECT_EQ(unit_.GetNumberOfLoadedModels(), 1U);
+}
+
+TEST_F(InferenceEnginePoolFixture, Acquire_GivenDifferentModels_ExpectSeparateLoadedModels)
+{
+    // Given
+    const auto params = GetParameters("model.pb");
+
+    // When
+    auto first_context = unit_.Acquire(InferenceEngineType::kTensorFlow, params);
+    auto second_context = unit_.Acquire(InferenceEngineType::kTensorFlow, GetParameters("other_model.pb"));
+    auto third_context = unit_.Acquire(InferenceEngineType::kOpenCV, params);
+
+    // Then
+    EXPECT_EQ(number_of_created_engines_, 3);
+    EXPECT_EQ(unit_.GetNumberOfLoadedModels(), 3U);
+}
+
+TEST_F(InferenceEnginePoolFixture, Acquire_GivenThreadBudget_ExpectCappedThreads)
+{
+    // Given
+    auto params = GetParameters("model.pb");
+    params.intra_op_threads = 3;
+    params.inter_op_threads = 8;
+
+    // When
+    auto first_context = unit_.Acquire(InferenceEngineType::kTensorFlow, params);
+    auto second_context = unit_.Acquire(InferenceEngineType::kTensorFlow, GetParameters("other_model.pb"));
+    auto third_context = unit_.Acquire(InferenceEngineType::kTensorFlow, GetParameters("third_model.pb"));
+
+    // Then
+    ASSERT_EQ(requested_params_.size(), 3U);
+    EXPECT_EQ(requested_params_.at(0).intra_op_threads, 3);
+    EXPECT_EQ(requested_params_.at(0).inter_op_threads, kMaxInterOpThreads);
+    EXPECT_EQ(requested_params_.at(1).intra_op_threads, 1);
+    EXPECT_EQ(requested_params_.at(1).inter_op_threads, 1);
+    EXPECT_EQ(requested_params_.at(2).intra_op_threads, 1);
+    EXPECT_EQ(unit_.GetAvailableIntraOpThreads(), 0);
+    EXPECT_EQ(unit_.GetAvailableInterOpThreads(), 0);
+}
+
+TEST_F(InferenceEnginePoolFixture, Acquire_GivenReleasedContexts_ExpectReturnedThreads)
+{
+    // Given
+    auto first_context = unit_.Acquire(InferenceEngineType::kTensorFlow, GetParameters("model.pb"));
+    auto second_context = unit_.Acquire(InferenceEngineType::kTensorFlow, GetParameters("model.pb"));
+    ASSERT_EQ(unit_.GetAvailableIntraOpThreads(), kMaxIntraOpThreads / InferenceEnginePool::kDefaultThreadsShare);
+
+    // When
+    first_context.reset();
+    const auto available_threads_with_second_context = unit_.GetAvailableIntraOpThreads();
+    second_context.reset();
+
+    // Then
+    EXPECT_EQ(available_threads_with_second_context, kMaxIntraOpThreads / InferenceEnginePool::kDefaultThreadsShare);
+    EXPECT_EQ(unit_.GetAvailableIntraOpThreads(), kMaxIntraOpThreads);
+    EXPECT_EQ(unit_.GetAvailableInterOpThreads(), kMaxInterOpThreads);
+    EXPECT_EQ(unit_.GetNumberOfLoadedModels(), 0U);
+}
+
+TEST_F(InferenceEnginePoolFixture, Acquire_GivenDefaultThreads_ExpectShareOfBudget)
+{
+    // Given
+    const auto params = GetParameters("model.pb");
+
+    // When
+    auto first_context = unit_.Acquire(InferenceEngineType::kTensorFlow, params);
+    auto second_context = unit_.Acquire(InferenceEngineType::kTensorFlow, GetParameters("other_model.pb"));
+
+    // Then
+    ASSERT_EQ(requested_params_.size(), 2U);
+    EXPECT_EQ(requested_params_.at(0).intra_op_threads, kMaxIntraOpThreads / InferenceEnginePool::kDefaultThreadsShare);
+    EXPECT_EQ(requested_params_.at(1).intra_op_threads, kMaxIntraOpThreads / InferenceEnginePool::kDefaultThreadsShare);
+    EXPECT_EQ(unit_.GetAvailableIntraOpThreads(), 0);
+}
+
+TEST_F(InferenceEnginePoolFixture, Acquire_GivenDifferentOutputs_ExpectSeparateLoadedModels)
+{
+    // Given
+    auto params = GetParameters("model.pb");
+    auto other_params = GetParameters("model.pb");
+    params.output_tensor_names = {"detection_boxes"};
+    other_params.output_tensor_names = {"detection_scores"};
+
+    // When
+    auto first_context = unit_.Acquire(InferenceEngineType::kTensorFlow, params);
+    auto second_context = unit_.Acquire(InferenceEngineType::kTensorFlow, other_params);
+
+    // Then
+    EXPECT_EQ(number_of_created_engines_, 2);
+}
+
+TEST_F(InferenceEnginePoolFixture, Acquire_GivenDifferentSettings_ExpectSeparateLoadedModels)
+{
+    // Given
+    const auto params = GetParameters("model.pb");
+    auto resized_params = params;
+    resized_params.input_size = cv::Size{300, 300};
+    auto scaled_params = params;
+    scaled_params.input_scale = 1.0F / 255.0F;
+    auto unoptimized_params = params;
+    unoptimized_params.graph_optimization = false;
+
+    // When
+    auto first_context = unit_.Acquire(InferenceEngineType::kTensorFlow, params);
+    auto resized_context = unit_.Acquire(InferenceEngineType::kTensorFlow, resized_params);
+    auto scaled_context = unit_.Acquire(InferenceEngineType::kTensorFlow, scaled_params);
+    auto unoptimized_context = unit_.Acquire(InferenceEngineType::kTensorFlow, unoptimized_params);
+
+    // Then
+    ASSERT_EQ(requested_params_.size(), 4U);
+    EXPECT_EQ(requested_params_.at(1).input_size, resized_params.input_size);
+    EXPECT_FLOAT_EQ(requested_params_.at(2).input_scale, scaled_params.input_scale);
+    EXPECT_FALSE(requested_params_.at(3).graph_optimization);
+    EXPECT_EQ(unit_.GetNumberOfLoadedModels(), 4U);
+}
+
+TEST_F(InferenceEnginePoolFixture, Acquire_GivenDifferentThreads_ExpectSingleLoadedModel)
+{
+    // Given
+    const auto params = GetParameters("model.pb");
+    auto other_params = params;
+    other_params.intra_op_threads = 1;
+
+    // When
+    auto first_context = unit_.Acquire(InferenceEngineType::kTensorFlow, params);
+    auto second_context = unit_.Acquire(InferenceEngineType::kTensorFlow, other_params);
+
+    // Then
+    EXPECT_EQ(number_of_created_engines_, 1);
+}
+
+TEST_F(InferenceEnginePoolFixture, Execute_GivenSingleContext_ExpectViewsOnModelResults)
+{
+    // Given
+    auto context = unit_.Acquire(InferenceEngineType::kTensorFlow, GetParameters("model.pb"));
+    context->Init();
+
+    // When
+    context->Execute(image_);
+
+    // Then
+    ASSERT_EQ(context->GetResults().size(), 1U);
+    EXPECT_EQ(context->GetResults().front().data, batch_results_.front().front().data);
+}
+
+TEST_F(InferenceEnginePoolFixture, Execute_GivenSharedModel_ExpectResultsOwnedByContext)
+{
+    // Given
+    auto first_context = unit_.Acquire(InferenceEngineType::kTensorFlow, GetParameters("model.pb"));
+    auto second_context = unit_.Acquire(InferenceEngineType::kTensorFlow, GetParameters("model.pb"));
+    first_context->Init();
+    second_context->Init();
+
+    // When
+    first_context->Execute(image_);
+    second_context->Execute(image_);
+
+    // Then
+    ASSERT_EQ(first_context->GetResults().size(), 1U);
+    ASSERT_EQ(second_context->GetResults().size(), 1U);
+    EXPECT_NE(first_context->GetResults().front().data, second_context->GetResults().front().data);
+    EXPECT_FLOAT_EQ(first_context->GetResults().front().at<float>(0, 0), 1.0F);
+    EXPECT_FLOAT_EQ(second_context->GetResults().front().at<float>(0, 0), 1.0F);
+}
+
+TEST(SharedInferenceEngineTest, Init_GivenMultipleContexts_ExpectModelInitialisedOnce)
+{
+    // Given
+    auto model = std::make_shared<SharedModel>();
+    auto engine = std::make_unique<::testing::NiceMock<test::support::InferenceEngineMock>>();
+    EXPECT_CALL(*engine, Init()).Times(1);
+    EXPECT_CALL(*engine, Shutdown()).Times(1);
+    model->engine = std::move(engine);
+    SharedInferenceEngine first_context{model};
+    SharedInferenceEngine second_context{model};
+
+    // When
+    first_context.Init();
+    second_context.Init();
+    first_context.Shutdown();
+    second_context.Shutdown();
+
+    // Then
+    EXPECT_EQ(model->number_of_users, 0);
+}
+
+}  // namespace
+}  // namespace perception
@@ -4,8 +4,12 @@
 ///
 #include "perception/inference_engine/i_inference_engine.h"
 #include "perception/inference_engine/inference_engine_strategy.h"
+#include "perception/inference_engine/inference_engine_warm_up.h"
 #include "perception/inference_engine/null_inference_engine.h"
+#include "perception/inference_engine/onnxruntime_inference_engine.h"
 #include "perception/inference_engine/opencv_inference_engine.h"
+#include "perception/inference_engine/test/support/inference_engine_parameters.h"
+#include "perception/inference_engine/test/support/mocks/inference_engine_mock.h"
 #include "perception/inference_engine/tf_inference_engine.h"
 #include "perception/inference_engine/tflite_inference_engine.h"
 #include "perception/inference_engine/torch_inference_engine.h"
@@ -19,53 +23,12 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace perception
 {
 namespace
 {
-template <typename T>
-InferenceEngineParameters GetInferenceEngineParameter()
-{
-    return InferenceEngineParameters{};
-}
-
-template <>
-InferenceEngineParameters GetInferenceEngineParameter<TFInferenceEngine>()
-{
-    return InferenceEngineParameters{"external/ssd_mobilenet_v2_coco/saved_model",
-                                     "image_tensor",
-                                     {"detection_classes", "detection_scores", "detection_boxes", "num_detections"},
-                                     "no-config"};
-}
-
-template <>
-InferenceEngineParameters GetInferenceEngineParameter<TFLiteInferenceEngine>()
-{
-    return InferenceEngineParameters{"external/ssd_mobilenet_v2_coco/ssd_mobilenet_v2_coco_2018_03_29.tflite",
-                                     "image_tensor",
-                                     {"detection_classes", "detection_scores", "detection_boxes", "num_detections"},
-                                     "no-config"};
-}
-
-template <>
-InferenceEngineParameters GetInferenceEngineParameter<OpenCVInferenceEngine>()
-{
-    return InferenceEngineParameters{"external/ssd_mobilenet_v2_coco/ssd_mobilenet_v2_coco_2018_03_29.pb",
-                                     "image_tensor",
-                                     {"detection_out"},
-                                     "external/ssd_mobilenet_v2_coco/ssd_mobilenet_v2_coco_2018_03_29.pbtxt"};
-}
-
-template <>
-InferenceEngineParameters GetInferenceEngineParameter<TorchInferenceEngine>()
-{
-    return InferenceEngineParameters{"external/ssd_mobilenet_v2_coco/mobilenet-v1-ssd-mp-0_675_torchscript.pth",
-                                     "data",
-                                     {"confidence", "boxes"},
-                                     "no-config"};
-}
-
 template <typename T>
 class InferenceEngineFixture_WithInferenceEngineType : public ::testing::Test
 {
@@ -73,7 +36,7 @@ class InferenceEngineFixture_WithInferenceEngineType : public ::testing::Test
     InferenceEngineFixture_WithInferenceEngineType()
         : test_image_path_{"data/messi5.jpg"},
           test_image_{cv::imread(test_image_path_, cv::IMREAD_UNCHANGED)},
-          inference_engine_parameters_{GetInferenceEngineParameter<T>()},
+          inference_engine_parameters_{test::support::GetInferenceEngineParameter<T>()},
           unit_{std::make_unique<T>(inference_engine_parameters_)}
     {
     }
@@ -81,10 +44,13 @@ class InferenceEngineFixture_WithInferenceEngineType : public ::testing::Test
   protected:
     void SetUp() override { unit_->Init(); }
     void RunOnce() { unit_->Execute(test_image_); }
+    void RunBatch(const std::size_t batch_size) { unit_->ExecuteBatch(std::vector<Image>(batch_size, test_image_)); }
     void TearDown() override { unit_->Shutdown(); }
 
-    std::vector<cv::Mat> GetInferenceResults() const { return unit_->GetResults(); }
+    const std::vector<cv::Mat>& GetInferenceResults() const { return unit_->GetResults(); }
+    const std::vector<std::vector<cv::Mat>>& GetBatchInferenceResults() const { return unit_->GetBatchResults(); }
     InferenceEngineParameters GetInferenceParameters() const { return inference_engine_parameters_; }
+    bool IsBatchingSupported() const { return unit_->IsBatchingSupported(); }
 
   private:
     const std::string test_image_path_;
@@ -104,16 +70,299 @@ TYPED_TEST_P(InferenceEngineFixture_WithInferenceEngineType, InferenceEngine_Giv
     EXPECT_EQ(this->GetInferenceParameters().output_tensor_names.size(), actual.size());
 }
 
+TYPED_TEST_P(InferenceEngineFixture_WithInferenceEngineType, InferenceEngine_GivenResults_ExpectNoCopies)
+{
+    // Given
+    this->RunOnce();
+
+    // When
+    const auto& first = this->GetInferenceResults();
+    const auto& second = this->GetInferenceResults();
+
+    // Then
+    ASSERT_EQ(first.size(), second.size());
+    EXPECT_EQ(&first, &second);
+    for (std::size_t index = 0U; index < first.size(); ++index)
+    {
+        EXPECT_EQ(first.at(index).data, second.at(index).data);
+    }
+}
+
+TYPED_TEST_P(InferenceEngineFixture_WithInferenceEngineType,
+             InferenceEngine_GivenRepeatedExecution_ExpectReusedResultBuffers)
+{
+    // Given
+    this->RunOnce();
+    const auto* const warm_results = this->GetInferenceResults().data();
+
+    // When
+    this->RunOnce();
+    this->RunOnce();
+
+    // Then
+    const auto& actual = this->GetInferenceResults();
+    EXPECT_EQ(this->GetInferenceParameters().output_tensor_names.size(), actual.size());
+    EXPECT_EQ(warm_results, actual.data());
+}
+
+TYPED_TEST_P(InferenceEngineFixture_WithInferenceEngineType, InferenceEngine_GivenBatchOfImages_ExpectResultsPerImage)
+{
+    // Given (models without batch dimension, e.g. TFLite SSD post-processing, accept a single image only)
+    const auto batch_size = this->IsBatchingSupported() ? 3U : 1U;
+
+    // When
+    this->RunBatch(batch_size);
+
+    // Then
+    const auto& actual = this->GetBatchInferenceResults();
+    ASSERT_EQ(actual.size(), batch_size);
+    for (const auto& results : actual)
+    {
+        EXPECT_EQ(this->GetInferenceParameters().output_tensor_names.size(), results.size());
+    }
+}
+
+TYPED_TEST_P(InferenceEngineFixture_WithInferenceEngineType, InferenceEngine_GivenSingleImage_ExpectBatchOfOneResult)
+{
+    // When
+    this->RunOnce();
+
+    // Then
+    const auto& actual = this->GetBatchInferenceResults();
+    ASSERT_EQ(actual.size(), 1U);
+    EXPECT_EQ(actual.front().size(), this->GetInferenceResults().size());
+}
+
 REGISTER_TYPED_TEST_SUITE_P(InferenceEngineFixture_WithInferenceEngineType,
-                            InferenceEngine_GivenTypicalInputs_ExpectInferenceResults);
+                            InferenceEngine_GivenTypicalInputs_ExpectInferenceResults,
+                            InferenceEngine_GivenResults_ExpectNoCopies,
+                            InferenceEngine_GivenRepeatedExecution_ExpectReusedResultBuffers,
+                            InferenceEngine_GivenBatchOfImages_ExpectResultsPerImage,
+                            InferenceEngine_GivenSingleImage_ExpectBatchOfOneResult);
 
-typedef ::testing::
-    Types<TFInferenceEngine, TFLiteInferenceEngine, OpenCVInferenceEngine, TorchInferenceEngine, NullInferenceEngine>
-        InferenceEngineTestTypes;
+typedef ::testing::Types<TFInferenceEngine,
+                         TFLiteInferenceEngine,
+                         OpenCVInferenceEngine,
+                         TorchInferenceEngine,
+                         OnnxRuntimeInferenceEngine,
+                         NullInferenceEngine>
+    InferenceEngineTestTypes;
 INSTANTIATE_TYPED_TEST_SUITE_P(InferenceEngine,
                                InferenceEngineFixture_WithInferenceEngineType,
                                InferenceEngineTestTypes);
 
+TEST(NullInferenceEngineTest, GetInputTensorInfo_GivenInputSize_ExpectInputSize)
+{
+    // Given
+    InferenceEngineParameters parameters{};
+    parameters.input_size = cv::Size{320, 240};
+    NullInferenceEngine unit{parameters};
+
+    // When
+    unit.Init();
+
+    // Then
+    const auto& actual = unit.GetInputTensorInfo();
+    EXPECT_EQ(actual.size, (cv::Size{320, 240}));
+    EXPECT_EQ(actual.channels, 3);
+    EXPECT_EQ(actual.depth, CV_8U);
+}
+
+TEST(NullInferenceEngineTest, Init_GivenWarmUpIterations_ExpectWarmUpStatistics)
+{
+    // Given
+    InferenceEngineParameters parameters{};
+    parameters.warm_up_iterations = 3;
+    NullInferenceEngine unit{parameters};
+
+    // When
+    unit.Init();
+
+    // Then
+    const auto& actual = unit.GetWarmUpStatistics();
+    EXPECT_EQ(actual.iterations, 3);
+    EXPECT_GE(actual.cold_latency.count(), 0);
+    EXPECT_GE(actual.warm_latency.count(), 0);
+}
+
+TEST(InferenceEngineWarmUpTest, WarmUp_GivenIterations_ExpectSyntheticInferencesAtInputSize)
+{
+    // Given
+    ::testing::StrictMock<test::support::InferenceEngineMock> inference_engine{};
+    EXPECT_CALL(inference_engine,
+                Execute(::testing::Truly([](const Image& image) { return image.size() == cv::Size{320, 240}; })))
+        .Times(5);
+
+    // When
+    const auto actual = WarmUp(inference_engine, cv::Size{320, 240}, 5);
+
+    // Then
+    EXPECT_EQ(actual.iterations, 5);
+}
+
+TEST(InferenceEngineWarmUpTest, WarmUp_GivenDynamicInputSize_ExpectSyntheticInferencesAtDefaultSize)
+{
+    // Given
+    ::testing::StrictMock<test::support::InferenceEngineMock> inference_engine{};
+    EXPECT_CALL(inference_engine,
+                Execute(::testing::Truly([](const Image& image) { return image.size() == kDefaultWarmUpInputSize; })))
+        .Times(2);
+
+    // When
+    const auto actual = WarmUp(inference_engine, InputTensorInfo{}, 2);
+
+    // Then
+    EXPECT_EQ(actual.iterations, 2);
+}
+
+TEST(InferenceEngineWarmUpTest, WarmUp_GivenSingleChannelInput_ExpectSyntheticInferencesWithSingleChannel)
+{
+    // Given
+    InputTensorInfo input_tensor_info{};
+    input_tensor_info.channels = 1;
+    ::testing::StrictMock<test::support::InferenceEngineMock> inference_engine{};
+    EXPECT_CALL(inference_engine, Execute(::testing::Truly([](const Image& image) { return image.channels() == 1; })))
+        .Times(2);
+
+    // When
+    const auto actual = WarmUp(inference_engine, input_tensor_info, 2);
+
+    // Then
+    EXPECT_EQ(actual.iterations, 2);
+}
+
+TEST(InferenceEngineWarmUpTest, WarmUp_GivenNoIterations_ExpectNoInference)
+{
+    // Given
+    ::testing::StrictMock<test::support::InferenceEngineMock> inference_engine{};
+    EXPECT_CALL(inference_engine, Execute(::testing::_)).Times(0);
+
+    // When
+    const auto actual = WarmUp(inference_engine, kDefaultWarmUpInputSize, 0);
+
+    // Then
+    EXPECT_EQ(actual.iterations, 0);
+    EXPECT_EQ(actual.cold_latency.count(), 0);
+}
+
+TEST(TFLiteInferenceEngineTest, Execute_GivenSsdModel_ExpectDetectionsAsViewsOnInterpreterBuffers)
+{
+    // Given
+    const Image image{cv::imread("data/messi5.jpg", cv::IMREAD_COLOR)};
+    TFLiteInferenceEngine unit{test::support::GetInferenceEngineParameter<TFLiteInferenceEngine>()};
+    unit.Init();
+    unit.Execute(image);
+    std::vector<const uchar*> first_data{};
+    for (const auto& result : unit.GetResults())
+    {
+        first_data.push_back(result.data);
+    }
+
+    // When
+    unit.Execute(image);
+
+    // Then
+    const auto& actual = unit.GetResults();
+    ASSERT_EQ(actual.size(), first_data.size());
+    for (std::size_t index = 0U; index < actual.size(); ++index)
+    {
+        EXPECT_FALSE(actual.at(index).empty());
+        EXPECT_EQ(actual.at(index).depth(), CV_32F);
+        EXPECT_EQ(actual.at(index).data, first_data.at(index));
+    }
+    unit.Shutdown();
+}
+
+TEST(TFLiteInferenceEngineTest, Init_GivenSsdModel_ExpectInputTensorInfoFromModel)
+{
+    // Given
+    TFLiteInferenceEngine unit{test::support::GetInferenceEngineParameter<TFLiteInferenceEngine>()};
+
+    // When
+    unit.Init();
+
+    // Then
+    const auto& actual = unit.GetInputTensorInfo();
+    EXPECT_EQ(actual.size, (cv::Size{300, 300}));
+    EXPECT_EQ(actual.channels, 3);
+    unit.Shutdown();
+}
+
+TEST(TFLiteInferenceEngineTest, Init_GivenUnknownOutputName_ExpectDeath)
+{
+    // Given
+    auto parameters = test::support::GetInferenceEngineParameter<TFLiteInferenceEngine>();
+    parameters.output_tensor_names = {"detection_classes"};
+    TFLiteInferenceEngine unit{parameters};
+
+    // When/Then
+    EXPECT_DEATH(unit.Init(), "has no output 'detection_classes'");
+}
+
+TEST(TFLiteInferenceEngineTest, Execute_GivenGrayscaleImage_ExpectDeath)
+{
+    // Given
+    const Image image{cv::imread("data/messi5.jpg", cv::IMREAD_GRAYSCALE)};
+    TFLiteInferenceEngine unit{test::support::GetInferenceEngineParameter<TFLiteInferenceEngine>()};
+    unit.Init();
+
+    // When/Then
+    EXPECT_DEATH(unit.Execute(image), "expects 3-channel images");
+    unit.Shutdown();
+}
+
+TEST(TFLiteInferenceEngineTest, Init_GivenSsdModel_ExpectBatchingNotSupported)
+{
+    // Given
+    TFLiteInferenceEngine unit{test::support::GetInferenceEngineParameter<TFLiteInferenceEngine>()};
+
+    // When
+    unit.Init();
+
+    // Then
+    EXPECT_FALSE(unit.IsBatchingSupported());
+    unit.Shutdown();
+}
+
+TEST(InferenceEngineStrategyTilingTest, Execute_GivenModelWithoutBatching_ExpectTilesExecutedOneByOne)
+{
+    // Given
+    const Image image{cv::imread("data/messi5.jpg", cv::IMREAD_COLOR)};
+    TilingParameters tiling_parameters{};
+    tiling_parameters.number_of_columns = 2;
+    InferenceEngineStrategy unit{};
+    unit.SelectInferenceEngine(InferenceEngineType::kTensorFlowLite,
+                               test::support::GetInferenceEngineParameter<TFLiteInferenceEngine>());
+    unit.SetTilingParameters(tiling_parameters);
+    unit.Init();
+
+    // When
+    unit.Execute(image);
+
+    // Then
+    EXPECT_EQ(unit.GetResults().size(), 4U);
+    unit.Shutdown();
+}
+
+TEST(InferenceEngineStrategyAsyncTest, Submit_GivenConsecutiveFrames_ExpectResultsOfEachFrame)
+{
+    // Given
+    const Image image{cv::imread("data/messi5.jpg", cv::IMREAD_COLOR)};
+    InferenceEngineStrategy unit{};
+    unit.SelectInferenceEngine(InferenceEngineType::kTensorFlowLite,
+                               test::support::GetInferenceEngineParameter<TFLiteInferenceEngine>());
+    unit.Init();
+
+    // When
+    auto first_frame = unit.Submit(image);
+    auto second_frame = unit.Submit(image);
+
+    // Then
+    EXPECT_EQ(first_frame.get().size(), 4U);
+    EXPECT_EQ(second_frame.get().size(), 4U);
+    unit.Shutdown();
+}
+
 class InferenceEngineStrategyTest : public ::testing::TestWithParam<InferenceEngineType>
 {
   public:
@@ -134,6 +383,7 @@ INSTANTIATE_TEST_SUITE_P(InferenceEngine,
                          ::testing::Values(InferenceEngineType::kTensorFlow,
                                            InferenceEngineType::kTensorFlowLite,
                                            InferenceEngineType::kTorch,
-                                           InferenceEngineType::kOpenCV));
+                                           InferenceEngineType::kOpenCV,
+                                           InferenceEngineType::kOnnxRuntime));
 }  // namespace
 }  // namespace perception
@@ -0,0 +1,133 @@
+///
+/// @file
+/// @copyright Copyright (c) 2023. MIT License.
+///
+#ifndef PERCEPTION_INFERENCE_ENGINE_TEST_SUPPORT_INFERENCE_ENGINE_PARAMETERS_H
+#define PERCEPTION_INFERENCE_ENGINE_TEST_SUPPORT_INFERENCE_ENGINE_PARAMETERS_H
+
+#include "perception/datatypes/inference_engine_type.h"
+#include "perception/inference_engine/null_inference_engine.h"
+#include "perception/inference_engine/onnxruntime_inference_engine.h"
+#include "perception/inference_engine/opencv_inference_engine.h"
+#include "perception/inference_engine/tf_inference_engine.h"
+#include "perception/inference_engine/tflite_inference_engine.h"
+#include "perception/inference_engine/torch_inference_engine.h"
+
+#include <string>
+
+namespace perception
+{
+namespace test
+{
+namespace support
+{
+/// @brief Provide parameters of the SSD model for the given Inference Engine (see GetModelName for the model used)
+///
+/// @tparam T [in] Inference Engine
+///
+/// @return Inference Engine Parameters (default parameters for engines without model, e.g. NullInferenceEngine)
+template <typename T>
+InferenceEngineParameters GetInferenceEngineParameter()
+{
+    return InferenceEngineParameters{};
+}
+
+template <>
+inline InferenceEngineParameters GetInferenceEngineParameter<TFInferenceEngine>()
+{
+    return InferenceEngineParameters{"external/ssd_mobilenet_v2_coco/saved_model",
+                                     "image_tensor",
+                                     {"detection_classes", "detection_scores", "detection_boxes", "num_detections"},
+                                     "no-config"};
+}
+
+template <>
+inline InferenceEngineParameters GetInferenceEngineParameter<TFLiteInferenceEngine>()
+{
+    // SSD post-processing outputs (boxes, classes, scores, num_detections), requested in order of the TF outputs
+    return InferenceEngineParameters{"external/ssd_mobilenet_v2_coco/ssd_mobilenet_v2_coco_2018_03_29.tflite",
+                                     "image_tensor",
+                                     {"TFLite_Detection_PostProcess:1",
+                                      "TFLite_Detection_PostProcess:2",
+                                      "TFLite_Detection_PostProcess",
+                                      "TFLite_Detection_PostProcess:3"},
+                                     "no-config"};
+}
+
+template <>
+inline InferenceEngineParameters GetInferenceEngineParameter<OpenCVInferenceEngine>()
+{
+    return InferenceEngineParameters{"external/ssd_mobilenet_v2_coco/ssd_mobilenet_v2_coco_2018_03_29.pb",
+                                     "image_tensor",
+                                     {"detection_out"},
+                                     "external/ssd_mobilenet_v2_coco/ssd_mobilenet_v2_coco_2018_03_29.pbtxt"};
+}
+
+template <>
+inline InferenceEngineParameters GetInferenceEngineParameter<TorchInferenceEngine>()
+{
+    InferenceEngineParameters parameters{"external/ssd_mobilenet_v2_coco/mobilenet-v1-ssd-mp-0_675_torchscript.pth",
+                                         "data",
+                                         {"confidence", "boxes"},
+                                         "no-config"};
+    // TorchScript does not declare input shapes
+    parameters.input_size = cv::Size{300, 300};
+    return parameters;
+}
+
+template <>
+inline InferenceEngineParameters GetInferenceEngineParameter<OnnxRuntimeInferenceEngine>()
+{
+    return InferenceEngineParameters{
+        "external/ssd_mobilenet_v1_onnx/file/ssd_mobilenet_v1_12.onnx",
+        "image_tensor:0",
+        {"detection_classes:0", "detection_scores:0", "detection_boxes:0", "num_detections:0"},
+        "no-config"};
+}
+
+/// @brief Provide name of the SSD model used by the given Inference Engine. TF, TFLite and OpenCV share SSD MobileNet
+/// v2 (COCO), whereas Torch and ONNX Runtime use SSD MobileNet v1 exports, hence their results are not comparable
+/// with the others.
+///
+/// @tparam T [in] Inference Engine
+///
+/// @return Model name (empty for engines without model, e.g. NullInferenceEngine)
+template <typename T>
+std::string GetModelName()
+{
+    return std::string{};
+}
+
+template <>
+inline std::string GetModelName<TFInferenceEngine>()
+{
+    return "ssd_mobilenet_v2_coco";
+}
+
+template <>
+inline std::string GetModelName<TFLiteInferenceEngine>()
+{
+    return "ssd_mobilenet_v2_coco";
+}
+
+template <>
+inline std::string GetModelName<OpenCVInferenceEngine>()
+{
+    return "ssd_mobilenet_v2_coco";
+}
+
+template <>
+inline std::string GetModelName<TorchInferenceEngine>()
+{
+    return "ssd_mobilenet_v1_voc";
+}
+
+template <>
+inline std::string GetModelName<OnnxRuntimeInferenceEngine>()
+{
+    return "ssd_mobilenet_v1_coco";
+}
+}  // namespace support
+}  // namespace test
+}  // namespace perception
+#endif  // PERCEPTION_INFERENCE_ENGINE_TEST_SUPPORT_INFERENCE_ENGINE_PARAMETERS_H
@@ -0,0 +1,39 @@
+///
+/// @file
+/// @copyright Copyright (c) 2023. MIT License.
+///
+#ifndef PERCEPTION_INFERENCE_ENGINE_TEST_SUPPORT_MOCKS_INFERENCE_ENGINE_MOCK_H
+#define PERCEPTION_INFERENCE_ENGINE_TEST_SUPPORT_MOCKS_INFERENCE_ENGINE_MOCK_H
+
+#include "perception/inference_engine/i_inference_engine.h"
+
+#include <gmock/gmock.h>
+
+#include <vector>
+
+namespace perception
+{
+namespace test
+{
+namespace support
+{
+class InferenceEngineMock : public IInferenceEngine
+{
+  public:
+    InferenceEngineMock() = default;
+
+    MOCK_METHOD0(Init, void());
+    MOCK_METHOD1(Execute, void(const Image&));
+    MOCK_METHOD1(ExecuteBatch, void(const std::vector<Image>&));
+    MOCK_METHOD0(Shutdown, void());
+    MOCK_CONST_METHOD0(GetResults, const std::vector<cv::Mat>&());
+    MOCK_CONST_METHOD0(GetBatchResults, const std::vector<std::vector<cv::Mat>>&());
+    MOCK_CONST_METHOD0(GetInputTensorInfo, const InputTensorInfo&());
+    MOCK_CONST_METHOD0(GetWarmUpStatistics, const WarmUpStatistics&());
+    MOCK_CONST_METHOD0(GetStageLatencies, const InferenceStageLatencies&());
+    MOCK_CONST_METHOD0(IsBatchingSupported, bool());
+};
+}  // namespace support
+}  // namespace test
+}  // namespace perception
+#endif  // PERCEPTION_INFERENCE_ENGINE_TEST_SUPPORT_MOCKS_INFERENCE_ENGINE_MOCK_H
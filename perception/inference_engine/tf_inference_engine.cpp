@@ -5,7 +5,11 @@
 #include "perception/inference_engine/tf_inference_engine.h"
 
 #include "perception/common/logging.h"
+#include "perception/common/thread_affinity.h"
+#include "perception/inference_engine/inference_engine_warm_up.h"
+#include "perception/inference_engine/stage_latency.h"
 
+#include <algorithm>
 #include <unordered_set>
 
 namespace perception
@@ -15,93 +19,304 @@ namespace
 /// @brief Converts tensorflow::Tensor to Image (aka cv::Mat)
 ///
 /// @param tensor [in] tensorflow::Tensor in [NxHxWxC form]
+/// @param batch_index [in] Index of the image within the batch (N)
+/// @param batch_size [in] Number of images fed to the model (leading dimension of the tensor has to match)
 ///
-/// @return Equivalent image (aka cv::Mat) for given tensorflow::Tensor by copying contents.
-cv::Mat ConvertToMatrix(const tensorflow::Tensor& tensor)
+/// @return Equivalent image (aka cv::Mat) for given batch index of tensorflow::Tensor (view on the tensor contents).
+cv::Mat ConvertToMatrix(const tensorflow::Tensor& tensor, const std::int64_t batch_index, const std::int64_t batch_size)
 {
+    CHECK((batch_size == 1) || ((tensor.dims() > 0) && (tensor.dim_size(0) == batch_size)))
+        << "Output tensor " << tensor.shape().DebugString() << " has no batch dimension for batch size " << batch_size
+        << ", model does not support batching";
+
     tensorflow::Tensor tensor_matrix = tensor;
     const auto rows = tensor_matrix.dims() > 1 ? static_cast<std::int32_t>(tensor_matrix.dim_size(1)) : 1;
     const auto cols = tensor_matrix.dims() > 2 ? static_cast<std::int32_t>(tensor_matrix.dim_size(2)) : 1;
     const auto channels = tensor_matrix.dims() > 3 ? static_cast<std::int32_t>(tensor_matrix.dim_size(3)) : 1;
-    auto* tensor_ptr = tensor_matrix.flat<float>().data();
+    const auto batch_stride = tensor_matrix.NumElements() / batch_size;
+    auto* tensor_ptr = tensor_matrix.flat<float>().data() + (batch_index * batch_stride);
     cv::Mat matrix{rows, cols, CV_32FC(channels), tensor_ptr};
     return matrix;
 }
 
-/// @brief Converts matrix (aka cv::Mat) to tensorflow::Tensor
+/// @brief Preprocesses images (aka cv::Mat) directly into batched tensorflow::Tensor. Tensor is (re)allocated only if
+/// its shape does not match with the images.
 ///
-/// @param matrix [in] matrix (aka cv::Mat)
+/// @param images [in] images (aka cv::Mat) of same size
+/// @param number_of_images [in] number of images (i.e. batch size)
+/// @param input_tensor_info [in] Input tensor expected by the model (images are fed at their own size, if dynamic)
+/// @param image_preprocessor [in] Preprocessing stage
+/// @param scale [in] Scale applied to each pixel of float inputs
+/// @param offset [in] Offset added to each scaled pixel of float inputs
+/// @param tensor [in/out] Equivalent tensorflow::Tensor for given images [NxHxWxC form]
 ///
-/// @return Equivalent tensorflow::Tensor for given image by copying the image contents to tensor.
-tensorflow::Tensor ConvertToTensor(const cv::Mat& matrix)
+/// @return True if tensor has been (re)allocated, otherwise False.
+bool ConvertToTensor(const Image* images,
+                     const std::size_t number_of_images,
+                     const InputTensorInfo& input_tensor_info,
+                     ImagePreprocessor& image_preprocessor,
+                     const float scale,
+                     const float offset,
+                     tensorflow::Tensor& tensor)
 {
-    tensorflow::Tensor tensor{tensorflow::DT_UINT8,
-                              tensorflow::TensorShape{1, matrix.rows, matrix.cols, matrix.channels()}};
-    auto* tensor_ptr = tensor.flat<tensorflow::uint8>().data();
-    cv::Mat tensor_matrix{matrix.rows, matrix.cols, CV_8UC3, tensor_ptr};
-    matrix.convertTo(tensor_matrix, CV_8UC3);
-    return tensor;
+    const auto& matrix = images[0];
+    const auto size = input_tensor_info.size.empty() ? matrix.size() : input_tensor_info.size;
+    const auto dtype = (input_tensor_info.depth == CV_32F) ? tensorflow::DT_FLOAT : tensorflow::DT_UINT8;
+    const tensorflow::TensorShape shape{
+        static_cast<std::int64_t>(number_of_images), size.height, size.width, input_tensor_info.channels};
+    const auto reallocated = (tensor.dtype() != dtype) || (tensor.shape() != shape);
+    if (reallocated)
+    {
+        tensor = tensorflow::Tensor{dtype, shape};
+    }
+    const auto image_size = static_cast<std::size_t>(size.area() * input_tensor_info.channels);
+    for (std::size_t index = 0U; index < number_of_images; ++index)
+    {
+        CHECK(images[index].size() == matrix.size() && images[index].type() == matrix.type())
+            << "Batched images must have same size and type.";
+        CHECK(images[index].channels() == input_tensor_info.channels)
+            << "Model expects " << input_tensor_info.channels << "-channel images (received "
+            << images[index].channels() << ")";
+        if (dtype == tensorflow::DT_FLOAT)
+        {
+            auto* tensor_ptr = tensor.flat<float>().data();
+            image_preprocessor.Preprocess(images[index], size, scale, offset, tensor_ptr + (index * image_size));
+        }
+        else
+        {
+            auto* tensor_ptr = tensor.flat<tensorflow::uint8>().data();
+            image_preprocessor.Preprocess(images[index], size, 1.0F, 0.0F, tensor_ptr + (index * image_size));
+        }
+    }
+    return reallocated;
+}
+
+/// @brief Provide input tensor declared by the model signature for the given input tensor
+///
+/// @param bundle [in] Loaded saved model
+/// @param input_tensor_name [in] Input Node/Tensor Name
+/// @param input_tensor_info [in] Input tensor used for dimensions the model does not declare (i.e. dynamic)
+///
+/// @return Declared input size, channels and element type (uint8 or float)
+InputTensorInfo ReadInputTensorInfo(const tensorflow::SavedModelBundle& bundle,
+                                    const std::string& input_tensor_name,
+                                    InputTensorInfo input_tensor_info)
+{
+    for (const auto& signature : bundle.meta_graph_def.signature_def())
+    {
+        for (const auto& input : signature.second.inputs())
+        {
+            const auto& shape = input.second.tensor_shape();
+            if ((input.second.name() != input_tensor_name) || (shape.dim_size() != 4))
+            {
+                continue;
+            }
+            if ((shape.dim(1).size() > 0) && (shape.dim(2).size() > 0))
+            {
+                input_tensor_info.size = cv::Size{static_cast<std::int32_t>(shape.dim(2).size()),
+                                                  static_cast<std::int32_t>(shape.dim(1).size())};
+            }
+            if (shape.dim(3).size() > 0)
+            {
+                input_tensor_info.channels = static_cast<std::int32_t>(shape.dim(3).size());
+            }
+            input_tensor_info.depth = (input.second.dtype() == tensorflow::DT_FLOAT) ? CV_32F : CV_8U;
+            return input_tensor_info;
+        }
+    }
+    return input_tensor_info;
+}
+
+/// @brief Provide whether the model signature declares a batch dimension for the given input and output tensors
+///
+/// @param bundle [in] Loaded saved model
+/// @param input_tensor_name [in] Input Node/Tensor Name
+/// @param output_tensor_names [in] Output Node/Tensor Names
+///
+/// @return True, if input batch dimension is not fixed to 1 and all the (declared) outputs share it
+bool ReadBatchingSupport(const tensorflow::SavedModelBundle& bundle,
+                         const std::string& input_tensor_name,
+                         const std::vector<std::string>& output_tensor_names)
+{
+    for (const auto& signature : bundle.meta_graph_def.signature_def())
+    {
+        for (const auto& input : signature.second.inputs())
+        {
+            const auto& shape = input.second.tensor_shape();
+            if ((input.second.name() != input_tensor_name) || (shape.dim_size() == 0) || (shape.dim(0).size() == 1))
+            {
+                continue;
+            }
+            const auto batch_size = shape.dim(0).size();
+            return std::all_of(signature.second.outputs().cbegin(),
+                               signature.second.outputs().cend(),
+                               [&output_tensor_names, batch_size](const auto& output) {
+                                   const auto& output_shape = output.second.tensor_shape();
+                                   const auto requested = std::find(output_tensor_names.cbegin(),
+                                                                    output_tensor_names.cend(),
+                                                                    output.second.name()) != output_tensor_names.cend();
+                                   return !requested || ((output_shape.dim_size() > 0) &&
+                                                         (output_shape.dim(0).size() == batch_size));
+                               });
+        }
+    }
+    return false;
 }
 }  // namespace
 
 TFInferenceEngine::TFInferenceEngine(const InferenceEngineParameters& params)
     : bundle_{std::make_shared<tensorflow::SavedModelBundle>()},
+      image_preprocessor_{TensorLayout::kNHWC, params.swap_red_blue},
+      input_scale_{params.input_scale},
+      input_offset_{params.input_offset},
       input_tensor_{},
       input_tensor_name_{params.input_tensor_name},
+      inputs_{},
       output_tensors_{},
       output_tensor_names_{params.output_tensor_names},
-      model_path_{params.model_path}
+      model_path_{params.model_path},
+      intra_op_threads_{params.intra_op_threads},
+      inter_op_threads_{params.inter_op_threads},
+      cpu_affinity_mask_{params.cpu_affinity_mask},
+      graph_optimization_{params.graph_optimization},
+      xla_jit_{params.xla_jit},
+      batching_supported_{false},
+      batch_results_(1U),
+      input_tensor_info_{params.input_size, 3, CV_8U},
+      warm_up_iterations_{params.warm_up_iterations},
+      warm_up_statistics_{},
+      stage_latencies_{}
 {
 }
 
 void TFInferenceEngine::Init()
 {
+    // session thread pools are spawned while loading the model, hence inherit the affinity (calling thread is
+    // restored once Init is done, e.g. threads spawned later by the node runner are not pinned)
+    const ScopedThreadAffinity scoped_thread_affinity{cpu_affinity_mask_};
+
     tensorflow::SessionOptions session_options{};
+    if (intra_op_threads_ > 0)
+    {
+        session_options.config.set_intra_op_parallelism_threads(intra_op_threads_);
+    }
+    if (inter_op_threads_ > 0)
+    {
+        session_options.config.set_inter_op_parallelism_threads(inter_op_threads_);
+    }
+    auto* graph_options = session_options.config.mutable_graph_options();
+    graph_options->mutable_optimizer_options()->set_opt_level(graph_optimization_ ? tensorflow::OptimizerOptions::L1
+                                                                                  : tensorflow::OptimizerOptions::L0);
+    graph_options->mutable_rewrite_options()->set_disable_meta_optimizer(!graph_optimization_);
+    graph_options->mutable_optimizer_options()->set_global_jit_level(xla_jit_ ? tensorflow::OptimizerOptions::ON_1
+                                                                              : tensorflow::OptimizerOptions::OFF);
     tensorflow::RunOptions run_options{};
     std::unordered_set<std::string> tags{"serve"};
 
     const auto ret = tensorflow::LoadSavedModel(session_options, run_options, model_path_, tags, bundle_.get());
     CHECK(ret.ok()) << "Failed to load saved model '" << model_path_ << "', (Message: " << ret.error_message() << ")";
 
+    output_tensors_.reserve(output_tensor_names_.size());
+    batch_results_.front().reserve(output_tensor_names_.size());
+
+    input_tensor_info_ = ReadInputTensorInfo(*bundle_, input_tensor_name_, input_tensor_info_);
+    batching_supported_ = ReadBatchingSupport(*bundle_, input_tensor_name_, output_tensor_names_);
+
     LOG(INFO) << "Successfully loaded saved model from '" << model_path_ << "'.";
+
+    // first session run triggers graph optimizations (and XLA compilation, if enabled)
+    warm_up_statistics_ = WarmUp(*this, input_tensor_info_, warm_up_iterations_);
 }
 
 void TFInferenceEngine::Execute(const Image& image)
 {
-    UpdateInput(image);
-    UpdateTensors();
-    UpdateOutputs();
+    MeasureLatency(stage_latencies_.preprocess, [this, &image] { UpdateInput(&image, 1U); });
+    MeasureLatency(stage_latencies_.invoke, [this] { UpdateTensors(); });
+    MeasureLatency(stage_latencies_.postprocess, [this] { UpdateOutputs(); });
+}
+
+void TFInferenceEngine::ExecuteBatch(const std::vector<Image>& images)
+{
+    CHECK(!images.empty()) << "Received empty batch.";
+    CHECK((images.size() == 1U) || batching_supported_)
+        << "Model '" << model_path_ << "' does not support batching, received " << images.size() << " images.";
+    MeasureLatency(stage_latencies_.preprocess, [this, &images] { UpdateInput(images.data(), images.size()); });
+    MeasureLatency(stage_latencies_.invoke, [this] { UpdateTensors(); });
+    MeasureLatency(stage_latencies_.postprocess, [this] { UpdateOutputs(); });
 }
 
 void TFInferenceEngine::Shutdown() {}
 
-std::vector<cv::Mat> TFInferenceEngine::GetResults() const
+const std::vector<cv::Mat>& TFInferenceEngine::GetResults() const
+{
+    return batch_results_.front();
+}
+
+const std::vector<std::vector<cv::Mat>>& TFInferenceEngine::GetBatchResults() const
+{
+    return batch_results_;
+}
+
+const InputTensorInfo& TFInferenceEngine::GetInputTensorInfo() const
+{
+    return input_tensor_info_;
+}
+
+const WarmUpStatistics& TFInferenceEngine::GetWarmUpStatistics() const
+{
+    return warm_up_statistics_;
+}
+
+const InferenceStageLatencies& TFInferenceEngine::GetStageLatencies() const
+{
+    return stage_latencies_;
+}
+
+bool TFInferenceEngine::IsBatchingSupported() const
 {
-    return results_;
+    return batching_supported_;
 }
 
-void TFInferenceEngine::UpdateInput(const Image& image)
+void TFInferenceEngine::UpdateInput(const Image* images, const std::size_t number_of_images)
 {
-    input_tensor_ = ConvertToTensor(image);
+    if (ConvertToTensor(images,
+                        number_of_images,
+                        input_tensor_info_,
+                        image_preprocessor_,
+                        input_scale_,
+                        input_offset_,
+                        input_tensor_))
+    {
+        inputs_.clear();
+        inputs_.emplace_back(input_tensor_name_, input_tensor_);
+    }
 }
 
 void TFInferenceEngine::UpdateTensors()
 {
-    const std::vector<std::pair<std::string, tensorflow::Tensor>> inputs{{input_tensor_name_, input_tensor_}};
     const std::vector<std::string> target_node_names{};
 
-    const auto ret = bundle_->GetSession()->Run(inputs, output_tensor_names_, target_node_names, &output_tensors_);
+    const auto ret = bundle_->GetSession()->Run(inputs_, output_tensor_names_, target_node_names, &output_tensors_);
     CHECK(ret.ok()) << "Unable to run Session, (Message: " << ret.error_message() << ")";
 
-    LOG(INFO) << "Successfully received results " << output_tensors_.size() << " outputs.";
+    LOG_EVERY_T(INFO, std::chrono::seconds{5})
+        << "Successfully received results " << output_tensors_.size() << " outputs.";
 }
 
 void TFInferenceEngine::UpdateOutputs()
 {
-    std::transform(output_tensors_.cbegin(),
-                   output_tensors_.cend(),
-                   std::back_inserter(results_),
-                   [](auto const& tensor) { return ConvertToMatrix(tensor); });
+    const auto batch_size = input_tensor_.dim_size(0);
+    batch_results_.resize(static_cast<std::size_t>(batch_size));
+    for (std::int64_t batch_index = 0; batch_index < batch_size; ++batch_index)
+    {
+        auto& results = batch_results_.at(static_cast<std::size_t>(batch_index));
+        results.resize(output_tensors_.size());
+        std::transform(
+            output_tensors_.cbegin(),
+            output_tensors_.cend(),
+            results.begin(),
+            [batch_index, batch_size](auto const& tensor) { return ConvertToMatrix(tensor, batch_index, batch_size); });
+    }
 }
 
 }  // namespace perception
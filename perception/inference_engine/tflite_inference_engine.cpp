@@ -5,93 +5,213 @@
 #include "perception/inference_engine/tflite_inference_engine.h"
 
 #include "perception/common/logging.h"
-#include "tensorflow/lite/builtin_op_data.h"
+#include "perception/inference_engine/inference_engine_warm_up.h"
+#include "perception/inference_engine/stage_latency.h"
 #include "tensorflow/lite/kernels/register.h"
 #include "tensorflow/lite/optional_debug_tools.h"
 
 #include <opencv4/opencv2/core.hpp>
-#include <opencv4/opencv2/imgproc.hpp>
+
+#include <algorithm>
+#include <chrono>
 
 namespace perception
 {
 namespace
 {
-/// @brief Resize Provided Image using TFLite Interpreter
-template <class T>
-void ResizeImage(T* out,
-                 const std::uint8_t* in,
-                 const std::int32_t image_height,
-                 const std::int32_t image_width,
-                 const std::int32_t image_channels,
-                 const std::int32_t wanted_height,
-                 const std::int32_t wanted_width,
-                 const std::int32_t wanted_channels,
-                 const bool input_floating,
-                 const float input_mean,
-                 const float input_std)
-{
-    std::int32_t number_of_pixels = image_height * image_width * image_channels;
-    std::unique_ptr<tflite::Interpreter> interpreter = std::make_unique<tflite::Interpreter>();
-
-    std::int32_t base_index = 0;
-
-    // two inputs: input and new_sizes
-    interpreter->AddTensors(2, &base_index);
-    // one output
-    interpreter->AddTensors(1, &base_index);
-    // set input and output tensors
-    interpreter->SetInputs({0, 1});
-    interpreter->SetOutputs({2});
-
-    // set parameters of tensors
-    TfLiteQuantizationParams quant;
-    interpreter->SetTensorParametersReadWrite(
-        0, kTfLiteFloat32, "input", {1, image_height, image_width, image_channels}, quant);
-    interpreter->SetTensorParametersReadWrite(1, kTfLiteInt32, "new_size", {2}, quant);
-    interpreter->SetTensorParametersReadWrite(
-        2, kTfLiteFloat32, "output", {1, wanted_height, wanted_width, wanted_channels}, quant);
-
-    tflite::ops::builtin::BuiltinOpResolver resolver;
-    const TfLiteRegistration* resize_op = resolver.FindOp(tflite::BuiltinOperator_RESIZE_BILINEAR, 1);
-    auto* params = reinterpret_cast<TfLiteResizeBilinearParams*>(malloc(sizeof(TfLiteResizeBilinearParams)));
-    params->align_corners = false;
-    interpreter->AddNodeWithParameters({0, 1}, {2}, nullptr, 0, params, resize_op, nullptr);
-
-    interpreter->AllocateTensors();
-
-    // fill input image
-    // in[] are integers, cannot do memcpy() directly
-    auto input = interpreter->typed_tensor<float>(0);
-    for (std::int32_t i = 0; i < number_of_pixels; i++)
+/// @brief Mean subtracted from the input pixels (for float models)
+constexpr float kInputMean{127.5F};
+
+/// @brief Standard deviation by which the input pixels are divided (for float models)
+constexpr float kInputStddev{127.5F};
+
+/// @brief Provide scale of the fused normalization and quantization, i.e. pixel * scale + offset
+///
+/// @param quantization [in] Quantization parameters of the model input tensor
+///
+/// @return Scale applied to each pixel
+float GetQuantizedScale(const TfLiteQuantizationParams& quantization)
+{
+    CHECK(quantization.scale > 0.0F) << "Received invalid quantization scale " << quantization.scale;
+    return 1.0F / (kInputStddev * quantization.scale);
+}
+
+/// @brief Provide offset of the fused normalization and quantization, i.e. pixel * scale + offset
+///
+/// @param quantization [in] Quantization parameters of the model input tensor
+///
+/// @return Offset added to each scaled pixel
+float GetQuantizedOffset(const TfLiteQuantizationParams& quantization)
+{
+    return static_cast<float>(quantization.zero_point) - (kInputMean * GetQuantizedScale(quantization));
+}
+
+/// @brief Provide number of elements of the tensor
+///
+/// @param tensor [in] TFLite tensor
+///
+/// @return Product of all the dimensions
+std::int32_t GetNumberOfElements(const TfLiteTensor& tensor)
+{
+    std::int32_t number_of_elements{1};
+    for (std::int32_t index = 0; index < tensor.dims->size; ++index)
     {
-        input[i] = in[i];
+        number_of_elements *= tensor.dims->data[index];
     }
+    return number_of_elements;
+}
 
-    // fill new_sizes
-    interpreter->typed_tensor<std::int32_t>(1)[0] = wanted_height;
-    interpreter->typed_tensor<std::int32_t>(1)[1] = wanted_width;
-
-    interpreter->Invoke();
+/// @brief Provide input tensor expected by the model
+///
+/// @param tensor [in] TFLite input tensor [NxHxWxC form]
+///
+/// @return Input size, channels and element type (CV_8U for unsupported types)
+InputTensorInfo ReadInputTensorInfo(const TfLiteTensor& tensor)
+{
+    InputTensorInfo input_tensor_info{};
+    input_tensor_info.size = cv::Size{tensor.dims->data[2], tensor.dims->data[1]};
+    input_tensor_info.channels = tensor.dims->data[3];
+    switch (tensor.type)
+    {
+        case TfLiteType::kTfLiteFloat32:
+        {
+            input_tensor_info.depth = CV_32F;
+            break;
+        }
+        case TfLiteType::kTfLiteInt8:
+        {
+            input_tensor_info.depth = CV_8S;
+            break;
+        }
+        default:
+        {
+            input_tensor_info.depth = CV_8U;
+            break;
+        }
+    }
+    return input_tensor_info;
+}
 
-    auto output = interpreter->typed_tensor<float>(2);
-    auto output_number_of_pixels = wanted_height * wanted_width * wanted_channels;
+/// @brief Dequantize contents of the quantized tensor as scale * (value - zero_point)
+///
+/// @param tensor [in] Quantized TFLite tensor
+/// @param contents [in] Quantized contents (1 x number of elements)
+/// @param dequantized [in/out] Buffer for dequantized contents (reallocated only if the tensor size changes)
+///
+/// @return Dequantized (float) contents
+cv::Mat Dequantize(const TfLiteTensor& tensor, const cv::Mat& contents, cv::Mat& dequantized)
+{
+    const auto scale = static_cast<double>(tensor.params.scale);
+    contents.convertTo(dequantized, CV_32F, scale, -scale * static_cast<double>(tensor.params.zero_point));
+    return dequantized;
+}
 
-    for (std::int32_t i = 0; i < output_number_of_pixels; i++)
+/// @brief Provide contents of the output tensor as a single row matrix (1 x number of elements) of its own type, i.e.
+/// view on the tensor buffer. Quantized tensors are dequantized to float.
+///
+/// @param tensor [in] TFLite output tensor
+/// @param dequantized [in/out] Buffer for dequantized contents (only used for quantized tensors)
+///
+/// @return Contents of the tensor, empty for unsupported tensor types
+cv::Mat GetContents(const TfLiteTensor& tensor, cv::Mat& dequantized)
+{
+    const auto number_of_elements = GetNumberOfElements(tensor);
+    const auto quantized = (tensor.params.scale > 0.0F);
+    switch (tensor.type)
     {
-        if (input_floating)
+        case TfLiteType::kTfLiteFloat32:
+        {
+            return cv::Mat{1, number_of_elements, CV_32FC1, tensor.data.f};
+        }
+        case TfLiteType::kTfLiteInt32:
+        {
+            return cv::Mat{1, number_of_elements, CV_32SC1, tensor.data.i32};
+        }
+        case TfLiteType::kTfLiteInt16:
+        {
+            return cv::Mat{1, number_of_elements, CV_16SC1, tensor.data.i16};
+        }
+        case TfLiteType::kTfLiteUInt8:
         {
-            out[i] = (output[i] - input_mean) / input_std;
+            const cv::Mat contents{1, number_of_elements, CV_8UC1, tensor.data.uint8};
+            return quantized ? Dequantize(tensor, contents, dequantized) : contents;
         }
-        else
+        case TfLiteType::kTfLiteInt8:
         {
-            out[i] = static_cast<std::uint8_t>(output[i]);
+            const cv::Mat contents{1, number_of_elements, CV_8SC1, tensor.data.int8};
+            return quantized ? Dequantize(tensor, contents, dequantized) : contents;
         }
+        default:
+        {
+            LOG_EVERY_T(ERROR, std::chrono::seconds{5}) << "Cannot handle output type " << tensor.type << " yet";
+            return cv::Mat{};
+        }
+    }
+}
+
+/// @brief Converts contents of the output tensor to Image (aka cv::Mat)
+///
+/// @param tensor [in] TFLite output tensor in [NxHxWxC form]
+/// @param contents [in] Contents of the tensor (see GetContents)
+/// @param batch_index [in] Index of the image within the batch (N)
+/// @param batch_size [in] Number of images fed to the model (leading dimension of the tensor has to match)
+///
+/// @return Equivalent image (aka cv::Mat) for given batch index (view on the contents, no copy).
+cv::Mat ConvertToMatrix(const TfLiteTensor& tensor,
+                        const cv::Mat& contents,
+                        const std::int32_t batch_index,
+                        const std::int32_t batch_size)
+{
+    if (contents.empty())
+    {
+        return cv::Mat{};
     }
+    const auto* dims = tensor.dims;
+    CHECK((batch_size == 1) || ((dims->size > 0) && (dims->data[0] == batch_size)))
+        << "Output tensor '" << ((tensor.name != nullptr) ? tensor.name : "")
+        << "' has no batch dimension for batch size " << batch_size << ", model does not support batching";
+
+    const auto rows = dims->size > 1 ? dims->data[1] : 1;
+    const auto cols = dims->size > 2 ? dims->data[2] : 1;
+    const auto channels = dims->size > 3 ? dims->data[3] : 1;
+    const auto batch_stride = contents.total() / static_cast<std::size_t>(batch_size);
+    auto* data = contents.data + (static_cast<std::size_t>(batch_index) * batch_stride * contents.elemSize1());
+    return cv::Mat{rows, cols, CV_MAKETYPE(contents.depth(), channels), data};
+}
+
+/// @brief Provide whether the interpreter runs the given custom operation
+///
+/// @param interpreter [in] TFLite interpreter (tensors allocated)
+/// @param custom_name [in] Name of the custom operation
+///
+/// @return True, if any node of the execution plan is the custom operation
+bool HasCustomOperation(const tflite::Interpreter& interpreter, const std::string& custom_name)
+{
+    const auto& execution_plan = interpreter.execution_plan();
+    return std::any_of(execution_plan.cbegin(), execution_plan.cend(), [&interpreter, &custom_name](const auto node) {
+        const auto* registration = &interpreter.node_and_registration(node)->second;
+        return (registration->custom_name != nullptr) && (custom_name == registration->custom_name);
+    });
 }
 }  // namespace
 
 TFLiteInferenceEngine::TFLiteInferenceEngine(const InferenceEngineParameters& params)
-    : model_path_{params.model_path}, results_{}
+    : model_path_{params.model_path},
+      intra_op_threads_{params.intra_op_threads},
+      xnnpack_delegate_{params.xnnpack_delegate},
+      model_{},
+      delegate_{nullptr, TfLiteXNNPackDelegateDelete},
+      interpreter_{},
+      image_preprocessor_{TensorLayout::kNHWC, params.swap_red_blue},
+      output_tensor_names_{params.output_tensor_names},
+      output_indices_{},
+      dequantized_outputs_{},
+      batching_supported_{false},
+      batch_results_(1U),
+      input_tensor_info_{},
+      warm_up_iterations_{params.warm_up_iterations},
+      warm_up_statistics_{},
+      stage_latencies_{}
 {
 }
 
@@ -106,72 +226,152 @@ void TFLiteInferenceEngine::Init()
     tflite::InterpreterBuilder(*model_, resolver)(&interpreter_);
     CHECK(interpreter_) << "Failed to construct interpreter";
 
+    if (intra_op_threads_ > 0)
+    {
+        interpreter_->SetNumThreads(intra_op_threads_);
+    }
+
+    if (xnnpack_delegate_)
+    {
+        auto options = TfLiteXNNPackDelegateOptionsDefault();
+        if (intra_op_threads_ > 0)
+        {
+            options.num_threads = intra_op_threads_;
+        }
+        delegate_ = DelegatePtr{TfLiteXNNPackDelegateCreate(&options), TfLiteXNNPackDelegateDelete};
+        CHECK_EQ(interpreter_->ModifyGraphWithDelegate(delegate_.get()), TfLiteStatus::kTfLiteOk)
+            << "Failed to apply XNNPACK delegate";
+    }
+
     CHECK_EQ(interpreter_->AllocateTensors(), TfLiteStatus::kTfLiteOk) << "Failed to allocate tensors!";
 
+    output_indices_ = GetOutputIndices();
+    dequantized_outputs_.resize(output_indices_.size());
+    batch_results_.front().reserve(output_indices_.size());
+
+    input_tensor_info_ = ReadInputTensorInfo(*interpreter_->tensor(interpreter_->inputs()[0]));
+    batching_supported_ = IsBatchDimensionShared();
+
     LOG(INFO) << "Successfully loaded tflite model from '" << model_path_ << "'.";
+
+    warm_up_statistics_ = WarmUp(*this, input_tensor_info_, warm_up_iterations_);
 }
 
 void TFLiteInferenceEngine::Execute(const Image& image)
 {
-    UpdateInput(image);
-    UpdateTensors();
-    UpdateOutputs();
+    MeasureLatency(stage_latencies_.preprocess, [this, &image] { UpdateInput(&image, 1U); });
+    MeasureLatency(stage_latencies_.invoke, [this] { UpdateTensors(); });
+    MeasureLatency(stage_latencies_.postprocess, [this] { UpdateOutputs(); });
+}
+
+void TFLiteInferenceEngine::ExecuteBatch(const std::vector<Image>& images)
+{
+    CHECK(!images.empty()) << "Received empty batch.";
+    CHECK((images.size() == 1U) || batching_supported_)
+        << "Model '" << model_path_ << "' does not support batching, received " << images.size() << " images.";
+    MeasureLatency(stage_latencies_.preprocess, [this, &images] { UpdateInput(images.data(), images.size()); });
+    MeasureLatency(stage_latencies_.invoke, [this] { UpdateTensors(); });
+    MeasureLatency(stage_latencies_.postprocess, [this] { UpdateOutputs(); });
 }
 
 void TFLiteInferenceEngine::Shutdown() {}
 
-std::vector<cv::Mat> TFLiteInferenceEngine::GetResults() const
+const std::vector<cv::Mat>& TFLiteInferenceEngine::GetResults() const
+{
+    return batch_results_.front();
+}
+
+const std::vector<std::vector<cv::Mat>>& TFLiteInferenceEngine::GetBatchResults() const
 {
-    return results_;
+    return batch_results_;
 }
 
-void TFLiteInferenceEngine::UpdateInput(const Image& image)
+const InputTensorInfo& TFLiteInferenceEngine::GetInputTensorInfo() const
+{
+    return input_tensor_info_;
+}
+
+const WarmUpStatistics& TFLiteInferenceEngine::GetWarmUpStatistics() const
+{
+    return warm_up_statistics_;
+}
+
+const InferenceStageLatencies& TFLiteInferenceEngine::GetStageLatencies() const
+{
+    return stage_latencies_;
+}
+
+bool TFLiteInferenceEngine::IsBatchingSupported() const
+{
+    return batching_supported_;
+}
+
+void TFLiteInferenceEngine::UpdateInput(const Image* images, const std::size_t number_of_images)
 {
     const auto input = interpreter_->inputs()[0];
 
-    TfLiteIntArray* dims = interpreter_->tensor(input)->dims;
-    const auto wanted_height = dims->data[1];
-    const auto wanted_width = dims->data[2];
-    const auto wanted_channels = dims->data[3];
-    const auto mean = 1.0;
-    const auto stddev = 0.0;
+    const TfLiteIntArray* dims = interpreter_->tensor(input)->dims;
+    const auto batch_size = static_cast<std::int32_t>(number_of_images);
+    if (dims->data[0] != batch_size)
+    {
+        const std::vector<std::int32_t> batched_dims{batch_size, dims->data[1], dims->data[2], dims->data[3]};
+        CHECK_EQ(interpreter_->ResizeInputTensor(input, batched_dims), TfLiteStatus::kTfLiteOk)
+            << "Failed to resize input tensor to batch size " << batch_size;
+        CHECK_EQ(interpreter_->AllocateTensors(), TfLiteStatus::kTfLiteOk) << "Failed to allocate tensors!";
+        dims = interpreter_->tensor(input)->dims;
+    }
+    const cv::Size input_size{dims->data[2], dims->data[1]};
+    const auto image_size = static_cast<std::size_t>(dims->data[1] * dims->data[2] * dims->data[3]);
 
-    switch (interpreter_->tensor(input)->type)
+    const auto& quantization = interpreter_->tensor(input)->params;
+    const auto quantized = (quantization.scale > 0.0F);
+    for (std::size_t index = 0U; index < number_of_images; ++index)
     {
-        case TfLiteType::kTfLiteFloat32:
+        CHECK(images[index].channels() == dims->data[3])
+            << "Model '" << model_path_ << "' expects " << dims->data[3] << "-channel images (received "
+            << images[index].channels() << ")";
+        switch (interpreter_->tensor(input)->type)
         {
-            ResizeImage<float>(interpreter_->typed_tensor<float>(input),
-                               image.data,
-                               image.rows,
-                               image.cols,
-                               image.channels(),
-                               wanted_height,
-                               wanted_width,
-                               wanted_channels,
-                               true,
-                               mean,
-                               stddev);
-            break;
-        }
-        case TfLiteType::kTfLiteUInt8:
-        {
-            ResizeImage<std::uint8_t>(interpreter_->typed_tensor<std::uint8_t>(input),
-                                      image.data,
-                                      image.rows,
-                                      image.cols,
-                                      image.channels(),
-                                      wanted_height,
-                                      wanted_width,
-                                      wanted_channels,
-                                      true,
-                                      mean,
-                                      stddev);
-            break;
-        }
-        default:
-        {
-            LOG(ERROR) << "Cannot handle input type " << interpreter_->tensor(input)->type << " yet";
-            break;
+            case TfLiteType::kTfLiteFloat32:
+            {
+                image_preprocessor_.Preprocess(images[index],
+                                               input_size,
+                                               1.0F / kInputStddev,
+                                               -kInputMean / kInputStddev,
+                                               interpreter_->typed_tensor<float>(input) + (index * image_size));
+                break;
+            }
+            case TfLiteType::kTfLiteUInt8:
+            {
+                auto* output = interpreter_->typed_tensor<std::uint8_t>(input) + (index * image_size);
+                if (quantized)
+                {
+                    image_preprocessor_.Preprocess(images[index],
+                                                   input_size,
+                                                   GetQuantizedScale(quantization),
+                                                   GetQuantizedOffset(quantization),
+                                                   output);
+                }
+                else
+                {
+                    image_preprocessor_.Preprocess(images[index], input_size, 1.0F, 0.0F, output);
+                }
+                break;
+            }
+            case TfLiteType::kTfLiteInt8:
+            {
+                image_preprocessor_.Preprocess(images[index],
+                                               input_size,
+                                               GetQuantizedScale(quantization),
+                                               GetQuantizedOffset(quantization),
+                                               interpreter_->typed_tensor<std::int8_t>(input) + (index * image_size));
+                break;
+            }
+            default:
+            {
+                LOG(ERROR) << "Cannot handle input type " << interpreter_->tensor(input)->type << " yet";
+                break;
+            }
         }
     }
 }
@@ -182,15 +382,74 @@ void TFLiteInferenceEngine::UpdateTensors()
     CHECK_EQ(ret, TfLiteStatus::kTfLiteOk) << "Failed to invoke tflite!";
 }
 
+std::vector<std::int32_t> TFLiteInferenceEngine::GetOutputIndices() const
+{
+    const auto& outputs = interpreter_->outputs();
+    if (output_tensor_names_.empty())
+    {
+        return std::vector<std::int32_t>{outputs.cbegin(), outputs.cend()};
+    }
+
+    std::vector<std::int32_t> output_indices{};
+    output_indices.reserve(output_tensor_names_.size());
+    for (const auto& output_tensor_name : output_tensor_names_)
+    {
+        const auto it = std::find_if(outputs.cbegin(), outputs.cend(), [this, &output_tensor_name](const auto index) {
+            const auto* name = interpreter_->tensor(index)->name;
+            return (name != nullptr) && (output_tensor_name == name);
+        });
+        CHECK(it != outputs.cend()) << "Model '" << model_path_ << "' has no output '" << output_tensor_name
+                                    << "' (outputs: " << GetOutputNames() << ")";
+        output_indices.push_back(*it);
+    }
+    return output_indices;
+}
+
+std::string TFLiteInferenceEngine::GetOutputNames() const
+{
+    std::string output_names{};
+    for (const auto index : interpreter_->outputs())
+    {
+        const auto* name = interpreter_->tensor(index)->name;
+        output_names += (output_names.empty() ? "'" : ", '") + std::string{(name != nullptr) ? name : ""} + "'";
+    }
+    return output_names;
+}
+
+bool TFLiteInferenceEngine::IsBatchDimensionShared() const
+{
+    // SSD post-processing operation (e.g. ssd_mobilenet_v2) supports a single image only
+    if (HasCustomOperation(*interpreter_, "TFLite_Detection_PostProcess"))
+    {
+        return false;
+    }
+    const auto batch_size = interpreter_->tensor(interpreter_->inputs()[0])->dims->data[0];
+    return std::all_of(output_indices_.cbegin(), output_indices_.cend(), [this, batch_size](const auto index) {
+        const auto* dims = interpreter_->tensor(index)->dims;
+        return (dims->size > 0) && (dims->data[0] == batch_size);
+    });
+}
+
 void TFLiteInferenceEngine::UpdateOutputs()
 {
-    const auto output = interpreter_->outputs()[0];
-    const auto output_dims = interpreter_->tensor(output)->dims;
-    const auto output_size = output_dims->data[output_dims->size - 1];
+    const auto batch_size = interpreter_->tensor(interpreter_->inputs()[0])->dims->data[0];
 
-    results_.resize(output_size);
+    batch_results_.resize(static_cast<std::size_t>(batch_size));
+    for (auto& results : batch_results_)
+    {
+        results.resize(output_indices_.size());
+    }
 
-    /// @todo Update results with inference output
+    for (std::size_t index = 0U; index < output_indices_.size(); ++index)
+    {
+        const auto& tensor = *interpreter_->tensor(output_indices_.at(index));
+        const auto contents = GetContents(tensor, dequantized_outputs_.at(index));
+        for (std::int32_t batch_index = 0; batch_index < batch_size; ++batch_index)
+        {
+            batch_results_.at(static_cast<std::size_t>(batch_index)).at(index) =
+                ConvertToMatrix(tensor, contents, batch_index, batch_size);
+        }
+    }
 }
 
 }  // namespace perception
@@ -7,6 +7,8 @@
 
 #include "perception/datatypes/inference_engine_type.h"
 #include "perception/inference_engine/i_inference_engine.h"
+#include "perception/inference_engine/image_preprocessor.h"
+#include "tensorflow/lite/delegates/xnnpack/xnnpack_delegate.h"
 #include "tensorflow/lite/interpreter.h"
 #include "tensorflow/lite/model.h"
 
@@ -31,35 +33,123 @@ class TFLiteInferenceEngine final : public IInferenceEngine
     /// @brief Execute Inference with TFLite Inference Engine
     void Execute(const Image& image) override;
 
+    /// @brief Execute Inference with TFLite Inference Engine for a batch of images (input tensor is resized to the
+    /// batch size, if required)
+    void ExecuteBatch(const std::vector<Image>& images) override;
+
     /// @brief Release TFLite Inference Engine
     void Shutdown() override;
 
     /// @brief Provide results in terms of Matrix
-    std::vector<cv::Mat> GetResults() const override;
+    const std::vector<cv::Mat>& GetResults() const override;
+
+    /// @brief Provide results for each image of the last executed batch
+    const std::vector<std::vector<cv::Mat>>& GetBatchResults() const override;
+
+    /// @brief Provide input tensor expected by the model (read at Init)
+    ///
+    /// @return Input size, channels and element type
+    const InputTensorInfo& GetInputTensorInfo() const override;
+
+    /// @brief Provide latencies measured while warming up the Inference Engine during Init
+    ///
+    /// @return Warm-up statistics (zero iterations, if warm-up is disabled)
+    const WarmUpStatistics& GetWarmUpStatistics() const override;
+
+    /// @brief Provide latencies of the stages of the last Execute/ExecuteBatch call
+    ///
+    /// @return Stage latencies (preprocess, invoke, postprocess)
+    const InferenceStageLatencies& GetStageLatencies() const override;
+
+    /// @brief Provide whether the model accepts more than one image per ExecuteBatch call (determined at Init)
+    ///
+    /// @return True, if ExecuteBatch accepts more than one image
+    bool IsBatchingSupported() const override;
 
   private:
-    /// @brief Updates Input Tensor by copying image to input_tensor
+    /// @brief Updates Input Tensor by preprocessing images directly into the (batched) input_tensor
     ///
-    /// @param image [in] Input image to be fed to Inference Engine
-    void UpdateInput(const Image& image);
+    /// @param images [in] Input images to be fed to Inference Engine
+    /// @param number_of_images [in] Number of input images (i.e. batch size)
+    void UpdateInput(const Image* images, const std::size_t number_of_images);
 
     /// @brief Updates Output Tensors by running the tensorflow session
     void UpdateTensors();
 
-    /// @brief Converts output_tensors to cv::Mat results
+    /// @brief Converts output tensors to cv::Mat results, i.e. views on the interpreter buffers with the tensor type
+    /// (quantized outputs are dequantized to float)
     void UpdateOutputs();
 
+    /// @brief Provide tensor indices of the requested outputs
+    ///
+    /// @note Aborts, if the model has no output of one of the names (e.g. SSD post-processing outputs are named
+    ///       TFLite_Detection_PostProcess, TFLite_Detection_PostProcess:1, ... instead of detection_boxes, ...).
+    ///
+    /// @return Tensor indices in order of output_tensor_names_ (all model outputs in model order, if no names are
+    ///         provided)
+    std::vector<std::int32_t> GetOutputIndices() const;
+
+    /// @brief Provide names of all the model outputs (for diagnostics)
+    ///
+    /// @return Comma separated, quoted output names in model order
+    std::string GetOutputNames() const;
+
+    /// @brief Provide whether the input and all the provided outputs share the leading (batch) dimension, i.e. the
+    /// input tensor can be resized to a batch of images
+    ///
+    /// @return True, if the model supports batching
+    bool IsBatchDimensionShared() const;
+
+    /// @brief TFLite delegate, released with its deleter
+    using DelegatePtr = std::unique_ptr<TfLiteDelegate, void (*)(TfLiteDelegate*)>;
+
     /// @brief Model root directory
     const std::string model_path_;
 
+    /// @brief Number of threads used to parallelize execution of a single operation (0: backend default)
+    const std::int32_t intra_op_threads_;
+
+    /// @brief Run supported operations with the XNNPACK delegate
+    const bool xnnpack_delegate_;
+
     /// @brief TFLite Model Buffer Instance
     std::unique_ptr<tflite::FlatBufferModel> model_;
 
+    /// @brief XNNPACK delegate (must outlive the interpreter)
+    DelegatePtr delegate_;
+
     /// @brief TFLite Model Interpreter instance
     std::unique_ptr<tflite::Interpreter> interpreter_;
 
-    /// @brief Output Tensors saved as cv::Mat
-    std::vector<cv::Mat> results_;
+    /// @brief Preprocessing stage, writing input images (resized, RGB, normalized/quantized) to the input tensor
+    ImagePreprocessor image_preprocessor_;
+
+    /// @brief Output Tensor Names
+    const std::vector<std::string> output_tensor_names_;
+
+    /// @brief Tensor indices of the provided outputs (in order of results)
+    std::vector<std::int32_t> output_indices_;
+
+    /// @brief Dequantized output tensors (float), for each quantized output (buffers reused between inferences)
+    std::vector<cv::Mat> dequantized_outputs_;
+
+    /// @brief Model supports more than one image per ExecuteBatch (determined at Init)
+    bool batching_supported_;
+
+    /// @brief Output Tensors saved as cv::Mat for each image of the batch
+    std::vector<std::vector<cv::Mat>> batch_results_;
+
+    /// @brief Input tensor expected by the model
+    InputTensorInfo input_tensor_info_;
+
+    /// @brief Number of warm-up inferences run during Init
+    const std::int32_t warm_up_iterations_;
+
+    /// @brief Latencies measured during warm-up
+    WarmUpStatistics warm_up_statistics_;
+
+    /// @brief Latencies of the stages of the last inference
+    InferenceStageLatencies stage_latencies_;
 };
 
 }  // namespace perception
@@ -5,9 +5,12 @@
 #include "perception/inference_engine/torch_inference_engine.h"
 
 #include "perception/common/logging.h"
+#include "perception/common/thread_affinity.h"
+#include "perception/inference_engine/inference_engine_warm_up.h"
+#include "perception/inference_engine/stage_latency.h"
 
 #include <opencv4/opencv2/core.hpp>
-#include <opencv4/opencv2/imgproc.hpp>
+#include <torch/csrc/jit/runtime/graph_executor.h>
 
 #include <algorithm>
 #include <iterator>
@@ -16,31 +19,25 @@ namespace perception
 {
 namespace
 {
-/// @brief Converts matrix (aka cv::Mat) to torch::Tensor
-///
-/// @param matrix [in] matrix (aka cv::Mat)
-///
-/// @return Equivalent torch::Tensor for given image by copying the image contents to tensor.
-torch::Tensor ConvertToTensor(const Image& image)
-{
-    auto tensor = torch::from_blob(image.data, {1, image.rows, image.cols, 3}, torch::kByte);
-    tensor = tensor.permute({0, 3, 1, 2});  // convert to CxHxW
-    tensor = tensor.to(torch::kF32);
-    return tensor;
-}
-
 /// @brief Converts torch::Tensor to Image (aka cv::Mat)
 ///
-/// @param tensor [in] torch::Tensor in [NxHxWxC form]
+/// @param tensor [in] torch::Tensor in [NxHxWxC form] (contiguous)
+/// @param batch_index [in] Index of the image within the batch (N)
+/// @param batch_size [in] Number of images fed to the model (leading dimension of the tensor has to match)
 ///
-/// @return Equivalent image (aka cv::Mat) for given torch::Tensor by copying contents.
-cv::Mat ConvertToMatrix(const torch::Tensor& tensor)
+/// @return Equivalent image (aka cv::Mat) for given batch index of torch::Tensor (view on the tensor contents).
+cv::Mat ConvertToMatrix(const torch::Tensor& tensor, const std::int64_t batch_index, const std::int64_t batch_size)
 {
+    CHECK((batch_size == 1) || ((tensor.dim() > 0) && (tensor.size(0) == batch_size)))
+        << "Output tensor " << tensor.sizes() << " has no batch dimension for batch size " << batch_size
+        << ", model does not support batching";
+
     const auto tensor_size = tensor.sizes();
-    const auto rows = tensor.dim() > 1 ? static_cast<std::int32_t>(tensor_size[0]) : 1;
-    const auto cols = tensor.dim() > 2 ? static_cast<std::int32_t>(tensor_size[1]) : 1;
-    const auto channels = tensor.dim() > 3 ? static_cast<std::int32_t>(tensor_size[2]) : 1;
-    auto* tensor_ptr = tensor.data_ptr();
+    const auto rows = tensor.dim() > 1 ? static_cast<std::int32_t>(tensor_size[1]) : 1;
+    const auto cols = tensor.dim() > 2 ? static_cast<std::int32_t>(tensor_size[2]) : 1;
+    const auto channels = tensor.dim() > 3 ? static_cast<std::int32_t>(tensor_size[3]) : 1;
+    const auto batch_stride = tensor.dim() > 0 ? tensor.stride(0) : 0;
+    auto* tensor_ptr = tensor.data_ptr<float>() + (batch_index * batch_stride);
     cv::Mat matrix{rows, cols, CV_32FC(channels), tensor_ptr};
     return matrix;
 }
@@ -48,60 +45,184 @@ cv::Mat ConvertToMatrix(const torch::Tensor& tensor)
 
 TorchInferenceEngine::TorchInferenceEngine(const InferenceEngineParameters& params)
     : net_{},
+      image_preprocessor_{TensorLayout::kNCHW, params.swap_red_blue},
+      input_scale_{params.input_scale},
+      input_offset_{params.input_offset},
       input_tensor_{},
+      inputs_{},
       input_tensor_name_{params.input_tensor_name},
       output_tensors_{},
       output_tensor_names_{params.output_tensor_names},
       model_path_{params.model_path},
-      results_{}
+      intra_op_threads_{params.intra_op_threads},
+      inter_op_threads_{params.inter_op_threads},
+      cpu_affinity_mask_{params.cpu_affinity_mask},
+      graph_optimization_{params.graph_optimization},
+      batching_supported_{false},
+      batch_results_(1U),
+      input_tensor_info_{params.input_size, 3, CV_32F},
+      warm_up_iterations_{params.warm_up_iterations},
+      warm_up_statistics_{},
+      stage_latencies_{}
 {
 }
 
 void TorchInferenceEngine::Init()
 {
+    // intra-op and inter-op thread pools are spawned lazily by the first runs (i.e. warm-up) on the calling thread,
+    // hence inherit the affinity (calling thread is restored once Init is done)
+    const ScopedThreadAffinity scoped_thread_affinity{cpu_affinity_mask_};
+
+    // Torch thread pools are process-wide (i.e. shared by all the Torch models)
+    if (intra_op_threads_ > 0)
+    {
+        torch::set_num_threads(intra_op_threads_);
+    }
+    if ((inter_op_threads_ > 0) && (torch::get_num_interop_threads() != inter_op_threads_))
+    {
+        try
+        {
+            torch::set_num_interop_threads(inter_op_threads_);
+        }
+        catch (const c10::Error& error)
+        {
+            LOG(WARNING) << "Unable to set number of inter-op threads (Message: " << error.what_without_backtrace()
+                         << ")";
+        }
+    }
+
+    // profiling and fusion passes of the graph executor are process-wide
+    torch::jit::setGraphExecutorOptimize(graph_optimization_);
     net_ = torch::jit::load(model_path_);
+    net_.eval();
+    if (graph_optimization_)
+    {
+        // inlines parameters/attributes as constants, enabling constant folding and fusion on the frozen graph
+        net_ = torch::jit::freeze(net_);
+    }
+
+    // TorchScript does not declare input shapes, hence input size is taken from the parameters
+    LOG_IF(WARNING, input_tensor_info_.size.empty())
+        << "No input size provided for torch model '" << model_path_ << "', images are fed at their own size.";
+
+    inputs_.resize(1U);
+    output_tensors_.reserve(output_tensor_names_.size());
+    batch_results_.front().reserve(output_tensor_names_.size());
+
+    // first runs profile and optimize the graph (profiling executor)
+    warm_up_statistics_ = WarmUp(*this, input_tensor_info_, warm_up_iterations_);
+    LOG_IF(INFO, !batching_supported_)
+        << "Batching not supported by torch model '" << model_path_ << "' (or warm-up disabled).";
 }
 
 void TorchInferenceEngine::Execute(const Image& image)
 {
-    UpdateInput(image);
-    UpdateTensors();
-    UpdateOutputs();
+    MeasureLatency(stage_latencies_.preprocess, [this, &image] { UpdateInput(&image, 1U); });
+    MeasureLatency(stage_latencies_.invoke, [this] { UpdateTensors(); });
+    MeasureLatency(stage_latencies_.postprocess, [this] { UpdateOutputs(); });
+}
+
+void TorchInferenceEngine::ExecuteBatch(const std::vector<Image>& images)
+{
+    CHECK(!images.empty()) << "Received empty batch.";
+    CHECK((images.size() == 1U) || batching_supported_)
+        << "Model '" << model_path_ << "' does not support batching, received " << images.size() << " images.";
+    MeasureLatency(stage_latencies_.preprocess, [this, &images] { UpdateInput(images.data(), images.size()); });
+    MeasureLatency(stage_latencies_.invoke, [this] { UpdateTensors(); });
+    MeasureLatency(stage_latencies_.postprocess, [this] { UpdateOutputs(); });
 }
 
 void TorchInferenceEngine::Shutdown() {}
 
-std::vector<cv::Mat> TorchInferenceEngine::GetResults() const
+const std::vector<cv::Mat>& TorchInferenceEngine::GetResults() const
+{
+    return batch_results_.front();
+}
+
+const std::vector<std::vector<cv::Mat>>& TorchInferenceEngine::GetBatchResults() const
+{
+    return batch_results_;
+}
+
+const InputTensorInfo& TorchInferenceEngine::GetInputTensorInfo() const
+{
+    return input_tensor_info_;
+}
+
+const WarmUpStatistics& TorchInferenceEngine::GetWarmUpStatistics() const
 {
-    return results_;
+    return warm_up_statistics_;
 }
 
-void TorchInferenceEngine::UpdateInput(const Image& image)
+const InferenceStageLatencies& TorchInferenceEngine::GetStageLatencies() const
 {
-    cv::Mat resized_image{};
-    cv::resize(image, resized_image, cv::Size(300, 300));
-    input_tensor_ = ConvertToTensor(resized_image);
+    return stage_latencies_;
+}
+
+bool TorchInferenceEngine::IsBatchingSupported() const
+{
+    return batching_supported_;
+}
+
+void TorchInferenceEngine::UpdateInput(const Image* images, const std::size_t number_of_images)
+{
+    const auto input_size = input_tensor_info_.size.empty() ? images[0].size() : input_tensor_info_.size;
+    const std::vector<std::int64_t> input_shape{
+        static_cast<std::int64_t>(number_of_images), input_tensor_info_.channels, input_size.height, input_size.width};
+    if (!input_tensor_.defined() || !input_tensor_.sizes().equals(input_shape))
+    {
+        input_tensor_ = torch::empty(input_shape, torch::kF32);
+        inputs_.front() = input_tensor_;
+    }
+
+    auto* tensor_ptr = input_tensor_.data_ptr<float>();
+    const auto image_size = static_cast<std::size_t>(input_tensor_.numel()) / number_of_images;
+    for (std::size_t index = 0U; index < number_of_images; ++index)
+    {
+        CHECK(images[index].channels() == input_tensor_info_.channels)
+            << "Model '" << model_path_ << "' expects " << input_tensor_info_.channels << "-channel images (received "
+            << images[index].channels() << ")";
+        image_preprocessor_.Preprocess(
+            images[index], input_size, input_scale_, input_offset_, tensor_ptr + (index * image_size));
+    }
 }
 
 void TorchInferenceEngine::UpdateTensors()
 {
-    const std::vector<torch::jit::IValue> inputs{{input_tensor_}};
-    const auto outputs = net_.forward(inputs);
+    const auto outputs = net_.forward(inputs_);
     const auto outputs_tuple = outputs.toTuple();
-    const auto outputs_elements = outputs_tuple->elements();
+    const auto& outputs_elements = outputs_tuple->elements();
+    output_tensors_.clear();
     std::transform(outputs_elements.cbegin(),
                    outputs_elements.cend(),
                    std::back_inserter(output_tensors_),
-                   [](const auto& output) { return output.toTensor(); });
+                   [](const auto& output) { return output.toTensor().contiguous(); });
 
-    LOG(INFO) << "Successfully received results " << output_tensors_.size() << " outputs.";
+    LOG_EVERY_T(INFO, std::chrono::seconds{5})
+        << "Successfully received results " << output_tensors_.size() << " outputs.";
 }
 
 void TorchInferenceEngine::UpdateOutputs()
 {
-    std::transform(output_tensors_.cbegin(),
-                   output_tensors_.cend(),
-                   std::back_inserter(results_),
-                   [](auto const& tensor) { return ConvertToMatrix(tensor); });
+    const auto batch_size = input_tensor_.size(0);
+    if (batch_size == 1)
+    {
+        // TorchScript does not declare output shapes, hence batch dimension is taken from single image results
+        batching_supported_ = std::all_of(output_tensors_.cbegin(), output_tensors_.cend(), [](const auto& tensor) {
+            return (tensor.dim() > 0) && (tensor.size(0) == 1);
+        });
+    }
+    batch_results_.resize(static_cast<std::size_t>(batch_size));
+    for (std::int64_t batch_index = 0; batch_index < batch_size; ++batch_index)
+    {
+        auto& results = batch_results_.at(static_cast<std::size_t>(batch_index));
+        results.resize(output_tensors_.size());
+        std::transform(output_tensors_.cbegin(),
+                       output_tensors_.cend(),
+                       results.begin(),
+                       [batch_index, batch_size](auto const& tensor) {
+                           return ConvertToMatrix(tensor, batch_index, batch_size);
+                       });
+    }
 }
 }  // namespace perception
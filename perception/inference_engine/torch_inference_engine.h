@@ -7,6 +7,7 @@
 
 #include "perception/datatypes/inference_engine_type.h"
 #include "perception/inference_engine/i_inference_engine.h"
+#include "perception/inference_engine/image_preprocessor.h"
 
 #include <torch/script.h>
 #include <torch/torch.h>
@@ -33,17 +34,47 @@ class TorchInferenceEngine final : public IInferenceEngine
     /// @brief Execute Inference with Inference Engine
     void Execute(const Image& image) override;
 
+    /// @brief Execute Inference with Torch Inference Engine for a batch of images (single forward pass)
+    ///
+    /// @param images [in] Images to be fed as input to Inference Engine
+    void ExecuteBatch(const std::vector<Image>& images) override;
+
     /// @brief Release Inference Engine
     void Shutdown() override;
 
     /// @brief Provide results in terms of Matrix
-    std::vector<cv::Mat> GetResults() const override;
+    const std::vector<cv::Mat>& GetResults() const override;
+
+    /// @brief Provide results for each image of the last executed batch
+    const std::vector<std::vector<cv::Mat>>& GetBatchResults() const override;
+
+    /// @brief Provide input tensor expected by the model (read at Init)
+    ///
+    /// @return Input size, channels and element type
+    const InputTensorInfo& GetInputTensorInfo() const override;
+
+    /// @brief Provide latencies measured while warming up the Inference Engine during Init
+    ///
+    /// @return Warm-up statistics (zero iterations, if warm-up is disabled)
+    const WarmUpStatistics& GetWarmUpStatistics() const override;
+
+    /// @brief Provide latencies of the stages of the last Execute/ExecuteBatch call
+    ///
+    /// @return Stage latencies (preprocess, invoke, postprocess)
+    const InferenceStageLatencies& GetStageLatencies() const override;
+
+    /// @brief Provide whether the model accepts more than one image per ExecuteBatch call (determined by the warm-up,
+    /// or by the first Execute if warm-up is disabled)
+    ///
+    /// @return True, if ExecuteBatch accepts more than one image
+    bool IsBatchingSupported() const override;
 
   private:
-    /// @brief Updates Input Tensor by copying image to input_tensor
+    /// @brief Updates Input Tensor by preprocessing images directly into the (batched) input_tensor
     ///
-    /// @param image [in] Input image to be fed to Inference Engine
-    void UpdateInput(const Image& image);
+    /// @param images [in] Input images to be fed to Inference Engine
+    /// @param number_of_images [in] Number of input images (i.e. batch size)
+    void UpdateInput(const Image* images, const std::size_t number_of_images);
 
     /// @brief Updates Output Tensors by running the tensorflow session
     void UpdateTensors();
@@ -54,13 +85,25 @@ class TorchInferenceEngine final : public IInferenceEngine
     /// @brief Model object
     torch::jit::Module net_;
 
-    /// @brief Input Tensor
+    /// @brief Preprocessing stage, writing input images (resized, RGB, planar) to the input tensor
+    ImagePreprocessor image_preprocessor_;
+
+    /// @brief Scale applied to each pixel of float inputs
+    const float input_scale_;
+
+    /// @brief Offset added to each scaled pixel of float inputs
+    const float input_offset_;
+
+    /// @brief Input Tensor [NxCxHxW form] (reused as long as the batch size does not change)
     torch::Tensor input_tensor_;
 
+    /// @brief Model inputs (i.e. input_tensor_)
+    std::vector<torch::jit::IValue> inputs_;
+
     /// @brief Input Tensor name
     const std::string input_tensor_name_;
 
-    /// @brief Output Tensors
+    /// @brief Output Tensors (capacity reserved at Init for all the requested outputs)
     std::vector<at::Tensor> output_tensors_;
 
     /// @brief Output Tensors names
@@ -69,8 +112,38 @@ class TorchInferenceEngine final : public IInferenceEngine
     /// @brief Model root directory
     const std::string model_path_;
 
-    /// @brief Output Tensors saved as cv::Mat
-    std::vector<cv::Mat> results_;
+    /// @brief Number of threads used to parallelize execution of a single operation (0: backend default)
+    const std::int32_t intra_op_threads_;
+
+    /// @brief Number of threads used to execute independent operations in parallel (0: backend default)
+    const std::int32_t inter_op_threads_;
+
+    /// @brief CPUs to which the engine threads are pinned (0: not pinned)
+    const std::uint64_t cpu_affinity_mask_;
+
+    /// @brief Enable graph optimizations
+    const bool graph_optimization_;
+
+    /// @brief All outputs of single image inferences (e.g. warm-up) have a leading batch dimension of 1, i.e. model
+    /// supports more than one image per ExecuteBatch
+    bool batching_supported_;
+
+    /// @brief Output Tensors saved as cv::Mat for each image of the batch (views on output_tensors_, reused on every
+    /// Execute)
+    std::vector<std::vector<cv::Mat>> batch_results_;
+
+    /// @brief Input tensor expected by the model (TorchScript does not declare it, hence 3 channels and input size
+    /// from the parameters)
+    InputTensorInfo input_tensor_info_;
+
+    /// @brief Number of warm-up inferences run during Init
+    const std::int32_t warm_up_iterations_;
+
+    /// @brief Latencies measured during warm-up
+    WarmUpStatistics warm_up_statistics_;
+
+    /// @brief Latencies of the stages of the last inference
+    InferenceStageLatencies stage_latencies_;
 };
 }  // namespace perception
 
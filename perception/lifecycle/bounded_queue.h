@@ -0,0 +1,130 @@
+///
+/// @file
+/// @copyright Copyright (c) 2023. MIT License.
+///
+#ifndef PERCEPTION_LIFECYCLE_BOUNDED_QUEUE_H
+#define PERCEPTION_LIFECYCLE_BOUNDED_QUEUE_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+namespace perception
+{
+namespace lifecycle
+{
+
+/// @brief Bounded, lock-free Single-Producer/Single-Consumer queue to hand-off data between nodes running on their own
+/// threads (i.e. camera -> object -> driver pipeline).
+///
+/// @note Exactly one thread may push and exactly one (other) thread may pop at a time. Buffer is preallocated, hence no
+/// allocation takes place while pushing/popping elements.
+///
+/// @tparam T [in] - Element type
+/// @tparam max_size [in] - Max number of elements queue can hold
+template <typename T, std::size_t max_size>
+class BoundedQueue final
+{
+  public:
+    /// @brief Underlying value type
+    using value_type = T;
+
+    /// @brief Container's size type
+    using size_type = std::size_t;
+
+    /// @brief Default Constructor
+    BoundedQueue() : buffer_{}, head_{0U}, tail_{0U} {}
+
+    /// @brief Add provided value at the back of the queue (Producer only)
+    ///
+    /// @param value [in] - Value
+    ///
+    /// @return True if value is added, otherwise False (i.e. queue is full)
+    bool try_push(const value_type& value)
+    {
+        value_type copy{value};
+        return try_push(std::move(copy));
+    }
+
+    /// @brief Add provided value at the back of the queue (Producer only)
+    ///
+    /// @param value [in] - Value
+    ///
+    /// @return True if value is added, otherwise False (i.e. queue is full)
+    bool try_push(value_type&& value)
+    {
+        const auto tail = tail_.load(std::memory_order_relaxed);
+        const auto next_tail = Next(tail);
+        if (next_tail == head_.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+        buffer_[tail] = std::move(value);
+        tail_.store(next_tail, std::memory_order_release);
+        return true;
+    }
+
+    /// @brief Remove value from the front of the queue (Consumer only)
+    ///
+    /// @param value [out] - Value
+    ///
+    /// @return True if value is removed, otherwise False (i.e. queue is empty)
+    bool try_pop(value_type& value)
+    {
+        const auto head = head_.load(std::memory_order_relaxed);
+        if (head == tail_.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+        value = std::move(buffer_[head]);
+        head_.store(Next(head), std::memory_order_release);
+        return true;
+    }
+
+    /// @brief Current number of elements in the queue
+    /// @note Only a snapshot, if used concurrently with push/pop
+    ///
+    /// @return Number of elements
+    size_type size() const noexcept
+    {
+        const auto head = head_.load(std::memory_order_acquire);
+        const auto tail = tail_.load(std::memory_order_acquire);
+        return ((tail + kBufferSize - head) % kBufferSize);
+    }
+
+    /// @brief Queue capacity
+    ///
+    /// @return Number of elements can be stored
+    constexpr size_type capacity() const noexcept { return max_size; }
+
+    /// @brief Check if queue is empty
+    ///
+    /// @return True if queue is empty, otherwise False
+    bool empty() const noexcept { return (0U == size()); }
+
+    /// @brief Check if queue is full (i.e. full capacity)
+    ///
+    /// @return True if queue is full, otherwise False
+    bool full() const noexcept { return (size() == capacity()); }
+
+  private:
+    /// @brief Underlying buffer size (one slot is kept free to distinguish full from empty)
+    static constexpr size_type kBufferSize{max_size + 1U};
+
+    /// @brief Provide next index in ring buffer
+    static constexpr size_type Next(const size_type index) noexcept { return ((index + 1U) % kBufferSize); }
+
+    /// @brief Preallocated ring buffer
+    std::array<value_type, kBufferSize> buffer_;
+
+    /// @brief Index of the front element (owned by consumer)
+    std::atomic<size_type> head_;
+
+    /// @brief Index of the next free slot (owned by producer)
+    std::atomic<size_type> tail_;
+};
+
+}  // namespace lifecycle
+}  // namespace perception
+#endif  /// PERCEPTION_LIFECYCLE_BOUNDED_QUEUE_H
@@ -0,0 +1,113 @@
+///
+/// @file
+/// @copyright Copyright (c) 2023. MIT License.
+///
+#include "perception/lifecycle/cycle_scheduler.h"
+
+#include "perception/common/logging.h"
+
+#include <algorithm>
+#include <thread>
+
+namespace perception
+{
+namespace lifecycle
+{
+
+constexpr std::int32_t CycleScheduler::kMaxDegradationFactor;
+
+CycleScheduler::CycleScheduler(const std::chrono::nanoseconds cycle_duration, const OverrunPolicy overrun_policy)
+    : cycle_duration_{cycle_duration},
+      overrun_policy_{overrun_policy},
+      degradation_factor_{1},
+      release_time_{},
+      next_release_time_{},
+      cycle_statistics_{}
+{
+    // cycle grid and number of skipped cycles are computed in multiples of the cycle duration
+    CHECK(cycle_duration_ > std::chrono::nanoseconds::zero())
+        << "Cycle duration must be positive (received " << cycle_duration_.count() << " ns).";
+}
+
+void CycleScheduler::Start(const Clock::time_point start)
+{
+    degradation_factor_ = 1;
+    release_time_ = start;
+    next_release_time_ = start;
+    cycle_statistics_ = CycleStatistics{};
+}
+
+void CycleScheduler::WaitForNextCycle()
+{
+    std::this_thread::sleep_until(next_release_time_);
+    OnCycleStarted(Clock::now());
+}
+
+void CycleScheduler::OnCycleStarted(const Clock::time_point started)
+{
+    release_time_ = next_release_time_;
+
+    const auto jitter = std::max(std::chrono::nanoseconds::zero(), started - release_time_);
+    cycle_statistics_.max_jitter = std::max(cycle_statistics_.max_jitter, jitter);
+    cycle_statistics_.total_jitter += jitter;
+    ++cycle_statistics_.number_of_cycles;
+}
+
+bool CycleScheduler::OnCycleFinished(const Clock::time_point finished)
+{
+    const auto cycle_duration = GetCycleDuration();
+    const auto deadline = release_time_ + cycle_duration;
+    if (finished <= deadline)
+    {
+        next_release_time_ = deadline;
+        if ((finished - release_time_) <= cycle_duration_)
+        {
+            degradation_factor_ = 1;
+        }
+        return false;
+    }
+
+    ++cycle_statistics_.number_of_overruns;
+    switch (overrun_policy_)
+    {
+        case OverrunPolicy::kCatchUp:
+        {
+            next_release_time_ = deadline;
+            break;
+        }
+        case OverrunPolicy::kDegrade:
+        {
+            degradation_factor_ = std::min(degradation_factor_ * 2, kMaxDegradationFactor);
+            next_release_time_ = finished;
+            break;
+        }
+        case OverrunPolicy::kSkip:
+        default:
+        {
+            const auto elapsed_cycles = (finished - release_time_ + cycle_duration - std::chrono::nanoseconds{1}) /
+                                        cycle_duration;
+            cycle_statistics_.number_of_skipped_cycles += (elapsed_cycles - 1);
+            next_release_time_ = release_time_ + (elapsed_cycles * cycle_duration);
+            break;
+        }
+    }
+    return true;
+}
+
+CycleScheduler::Clock::time_point CycleScheduler::GetNextReleaseTime() const
+{
+    return next_release_time_;
+}
+
+std::chrono::nanoseconds CycleScheduler::GetCycleDuration() const
+{
+    return (cycle_duration_ * degradation_factor_);
+}
+
+const CycleStatistics& CycleScheduler::GetCycleStatistics() const
+{
+    return cycle_statistics_;
+}
+
+}  // namespace lifecycle
+}  // namespace perception
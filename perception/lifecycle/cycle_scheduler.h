@@ -0,0 +1,142 @@
+///
+/// @file
+/// @copyright Copyright (c) 2023. MIT License.
+///
+#ifndef PERCEPTION_LIFECYCLE_CYCLE_SCHEDULER_H
+#define PERCEPTION_LIFECYCLE_CYCLE_SCHEDULER_H
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+
+namespace perception
+{
+namespace lifecycle
+{
+
+/// @brief Behavior of the scheduler, once a cycle overruns its deadline
+enum class OverrunPolicy : std::uint8_t
+{
+    kSkip = 0U,     ///< Drop missed cycles and continue with the next release time on the cycle grid
+    kCatchUp = 1U,  ///< Execute missed cycles back-to-back until scheduler caught up with the cycle grid
+    kDegrade = 2U,  ///< Double the cycle duration (up to a limit) until a cycle fits into nominal cycle duration again
+};
+
+/// @brief Cycle Statistics collected by the scheduler
+struct CycleStatistics
+{
+    /// @brief Number of cycles executed
+    std::int64_t number_of_cycles{0};
+
+    /// @brief Number of cycles, which finished after their deadline
+    std::int64_t number_of_overruns{0};
+
+    /// @brief Number of cycles dropped due to overrun (only for OverrunPolicy::kSkip)
+    std::int64_t number_of_skipped_cycles{0};
+
+    /// @brief Maximum release jitter (i.e. delay between release time and actual start of the cycle)
+    std::chrono::nanoseconds max_jitter{0};
+
+    /// @brief Accumulated release jitter for all the executed cycles
+    std::chrono::nanoseconds total_jitter{0};
+};
+
+/// @brief Deadline driven cycle scheduler, releasing cycles at absolute time points on a wall-clock cycle grid (i.e.
+/// start + n * cycle_duration), hence sleep inaccuracies do not accumulate over the time.
+class CycleScheduler final
+{
+  public:
+    /// @brief Clock used for scheduling
+    using Clock = std::chrono::steady_clock;
+
+    /// @brief Maximum factor by which cycle duration is stretched with OverrunPolicy::kDegrade
+    static constexpr std::int32_t kMaxDegradationFactor{8};
+
+    /// @brief Constructor
+    ///
+    /// @param cycle_duration [in] - Nominal cycle duration (aborts, if not positive)
+    /// @param overrun_policy [in] - Behavior on cycle overrun
+    explicit CycleScheduler(const std::chrono::nanoseconds cycle_duration, const OverrunPolicy overrun_policy);
+
+    /// @brief Start cycle grid with the first cycle released at provided time point
+    ///
+    /// @param start [in] - Release time of the first cycle
+    void Start(const Clock::time_point start);
+
+    /// @brief Sleep until release time of the next cycle and record its start
+    void WaitForNextCycle();
+
+    /// @brief Record start of the cycle (i.e. used to compute release jitter)
+    ///
+    /// @param started [in] - Time point at which cycle is started
+    void OnCycleStarted(const Clock::time_point started);
+
+    /// @brief Record end of the cycle. Detects overrun and computes release time of the next cycle based on the
+    /// overrun policy.
+    ///
+    /// @param finished [in] - Time point at which cycle is finished
+    ///
+    /// @return True if cycle overran its deadline, otherwise False
+    bool OnCycleFinished(const Clock::time_point finished);
+
+    /// @brief Provide release time of the next cycle
+    ///
+    /// @return next release time
+    Clock::time_point GetNextReleaseTime() const;
+
+    /// @brief Provide currently effective cycle duration (differs from nominal only with OverrunPolicy::kDegrade)
+    ///
+    /// @return effective cycle duration
+    std::chrono::nanoseconds GetCycleDuration() const;
+
+    /// @brief Provide collected cycle statistics
+    ///
+    /// @return cycle statistics
+    const CycleStatistics& GetCycleStatistics() const;
+
+  private:
+    /// @brief Nominal cycle duration
+    const std::chrono::nanoseconds cycle_duration_;
+
+    /// @brief Behavior on cycle overrun
+    const OverrunPolicy overrun_policy_;
+
+    /// @brief Factor by which nominal cycle duration is stretched (only for OverrunPolicy::kDegrade)
+    std::int32_t degradation_factor_;
+
+    /// @brief Release time of the current cycle
+    Clock::time_point release_time_;
+
+    /// @brief Release time of the next cycle
+    Clock::time_point next_release_time_;
+
+    /// @brief Collected cycle statistics
+    CycleStatistics cycle_statistics_;
+};
+
+inline const char* to_string(const OverrunPolicy& overrun_policy)
+{
+    switch (overrun_policy)
+    {
+        case OverrunPolicy::kSkip:
+            return "kSkip";
+        case OverrunPolicy::kCatchUp:
+            return "kCatchUp";
+        case OverrunPolicy::kDegrade:
+            return "kDegrade";
+        default:
+            return "ERROR: Unknown OverrunPolicy.";
+    }
+    return "ERROR: Unknown OverrunPolicy.";
+}
+
+inline std::ostream& operator<<(std::ostream& stream, const OverrunPolicy& overrun_policy)
+{
+    const char* name = to_string(overrun_policy);
+    stream << name;
+    return stream;
+}
+
+}  // namespace lifecycle
+}  // namespace perception
+#endif  /// PERCEPTION_LIFECYCLE_CYCLE_SCHEDULER_H
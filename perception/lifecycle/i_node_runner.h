@@ -8,6 +8,7 @@
 #include "perception/lifecycle/i_node.h"
 
 #include <chrono>
+#include <ostream>
 #include <string>
 
 namespace perception
@@ -15,6 +16,9 @@ namespace perception
 namespace lifecycle
 {
 
+/// @brief Default Cycle Duration
+static constexpr std::chrono::milliseconds kDefaultCycleDuration{40UL};
+
 /// @brief Interface to the middleware node runner
 class INodeRunner
 {
@@ -35,6 +39,11 @@ class INodeRunner
     /// @param duration [in] - Duration for which node will continue to run
     /// @param step [in] - Duration interval for which node will be stepped.
     virtual void RunForDuration(const std::chrono::milliseconds duration, const std::chrono::milliseconds step) = 0;
+
+    /// @brief Dump latency metrics (Init/Step/Shutdown percentiles, overruns) collected per node as JSON
+    ///
+    /// @param stream [out] - Stream to write metrics to
+    virtual void DumpMetrics(std::ostream& stream) const = 0;
 };
 
 }  // namespace lifecycle
@@ -0,0 +1,109 @@
+///
+/// @file
+/// @copyright Copyright (c) 2023. MIT License.
+///
+#include "perception/lifecycle/latency_histogram.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace perception
+{
+namespace lifecycle
+{
+
+constexpr std::int32_t LatencyHistogram::kSubBucketBits;
+constexpr std::int32_t LatencyHistogram::kMaxLatencyBits;
+constexpr std::int32_t LatencyHistogram::kNumberOfBuckets;
+
+LatencyHistogram::LatencyHistogram() : buckets_{}, count_{0U}, max_{0U}
+{
+    Reset();
+}
+
+void LatencyHistogram::Record(const std::chrono::nanoseconds latency) noexcept
+{
+    const auto value = static_cast<std::uint64_t>(std::max(latency.count(), std::chrono::nanoseconds::rep{0}));
+    buckets_[static_cast<std::size_t>(GetBucketIndex(value))].fetch_add(1U, std::memory_order_relaxed);
+    count_.fetch_add(1U, std::memory_order_relaxed);
+
+    auto max = max_.load(std::memory_order_relaxed);
+    while ((value > max) && !max_.compare_exchange_weak(max, value, std::memory_order_relaxed))
+    {
+    }
+}
+
+void LatencyHistogram::Reset() noexcept
+{
+    for (auto& bucket : buckets_)
+    {
+        bucket.store(0U, std::memory_order_relaxed);
+    }
+    count_.store(0U, std::memory_order_relaxed);
+    max_.store(0U, std::memory_order_relaxed);
+}
+
+std::int64_t LatencyHistogram::GetCount() const noexcept
+{
+    return static_cast<std::int64_t>(count_.load(std::memory_order_relaxed));
+}
+
+std::chrono::nanoseconds LatencyHistogram::GetPercentile(const double percentile) const noexcept
+{
+    const auto count = count_.load(std::memory_order_relaxed);
+    if (0U == count)
+    {
+        return std::chrono::nanoseconds::zero();
+    }
+
+    const auto fraction = std::min(std::max(percentile, 0.0), 100.0) / 100.0;
+    const auto rank = std::max(static_cast<std::uint64_t>(std::ceil(fraction * static_cast<double>(count))),
+                               std::uint64_t{1U});
+    const auto max = max_.load(std::memory_order_relaxed);
+
+    std::uint64_t cumulative_count{0U};
+    for (std::int32_t index = 0; index < kNumberOfBuckets; ++index)
+    {
+        cumulative_count += buckets_[static_cast<std::size_t>(index)].load(std::memory_order_relaxed);
+        if (cumulative_count >= rank)
+        {
+            return std::chrono::nanoseconds{static_cast<std::int64_t>(std::min(GetBucketUpperBound(index), max))};
+        }
+    }
+    return std::chrono::nanoseconds{static_cast<std::int64_t>(max)};
+}
+
+std::chrono::nanoseconds LatencyHistogram::GetMax() const noexcept
+{
+    return std::chrono::nanoseconds{static_cast<std::int64_t>(max_.load(std::memory_order_relaxed))};
+}
+
+std::int32_t LatencyHistogram::GetBucketIndex(const std::uint64_t value) noexcept
+{
+    constexpr std::uint64_t kSubBucketCount{1U << kSubBucketBits};
+    if (value < kSubBucketCount)
+    {
+        return static_cast<std::int32_t>(value);
+    }
+
+    const auto most_significant_bit = 63 - __builtin_clzll(value);
+    const auto shift = most_significant_bit - kSubBucketBits;
+    const auto index = (shift << kSubBucketBits) + static_cast<std::int32_t>(value >> shift);
+    return std::min(index, kNumberOfBuckets - 1);
+}
+
+std::uint64_t LatencyHistogram::GetBucketUpperBound(const std::int32_t index) noexcept
+{
+    constexpr std::int32_t kSubBucketCount{1 << kSubBucketBits};
+    if (index < (2 * kSubBucketCount))
+    {
+        return static_cast<std::uint64_t>(index);
+    }
+
+    const auto shift = (index >> kSubBucketBits) - 1;
+    const auto mantissa = static_cast<std::uint64_t>(index - (shift << kSubBucketBits));
+    return (((mantissa + 1U) << shift) - 1U);
+}
+
+}  // namespace lifecycle
+}  // namespace perception
@@ -0,0 +1,81 @@
+///
+/// @file
+/// @copyright Copyright (c) 2023. MIT License.
+///
+#ifndef PERCEPTION_LIFECYCLE_LATENCY_HISTOGRAM_H
+#define PERCEPTION_LIFECYCLE_LATENCY_HISTOGRAM_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace perception
+{
+namespace lifecycle
+{
+
+/// @brief Lock-free latency histogram with log-linear buckets (each power of two range is split into 16 linear
+/// sub-buckets, hence reported percentiles are within ~6% of the recorded latency).
+///
+/// @note Record() is wait-free and may be called concurrently from several threads, while percentiles are read.
+class LatencyHistogram final
+{
+  public:
+    /// @brief Number of linear sub-buckets per power of two range (as bits)
+    static constexpr std::int32_t kSubBucketBits{4};
+
+    /// @brief Number of bits of the largest latency (ns) recorded without saturation (~18 minutes)
+    static constexpr std::int32_t kMaxLatencyBits{40};
+
+    /// @brief Number of buckets
+    static constexpr std::int32_t kNumberOfBuckets{(kMaxLatencyBits - kSubBucketBits + 1) << kSubBucketBits};
+
+    /// @brief Default Constructor
+    LatencyHistogram();
+
+    /// @brief Record latency
+    ///
+    /// @param latency [in] - Measured latency
+    void Record(const std::chrono::nanoseconds latency) noexcept;
+
+    /// @brief Remove all the recorded latencies
+    void Reset() noexcept;
+
+    /// @brief Provide number of recorded latencies
+    ///
+    /// @return count
+    std::int64_t GetCount() const noexcept;
+
+    /// @brief Provide latency below which provided percentage of the recorded latencies fall
+    ///
+    /// @param percentile [in] - Percentile in range [0, 100] (i.e. 50.0, 99.0, 99.9)
+    ///
+    /// @return latency for the percentile (0ns, if nothing is recorded)
+    std::chrono::nanoseconds GetPercentile(const double percentile) const noexcept;
+
+    /// @brief Provide largest recorded latency
+    ///
+    /// @return max latency
+    std::chrono::nanoseconds GetMax() const noexcept;
+
+  private:
+    /// @brief Provide bucket index for the provided value (ns)
+    static std::int32_t GetBucketIndex(const std::uint64_t value) noexcept;
+
+    /// @brief Provide largest value (ns) covered by the bucket
+    static std::uint64_t GetBucketUpperBound(const std::int32_t index) noexcept;
+
+    /// @brief Number of recorded latencies per bucket
+    std::array<std::atomic<std::uint64_t>, kNumberOfBuckets> buckets_;
+
+    /// @brief Number of recorded latencies
+    std::atomic<std::uint64_t> count_;
+
+    /// @brief Largest recorded latency (ns)
+    std::atomic<std::uint64_t> max_;
+};
+
+}  // namespace lifecycle
+}  // namespace perception
+#endif  /// PERCEPTION_LIFECYCLE_LATENCY_HISTOGRAM_H
@@ -0,0 +1,44 @@
+///
+/// @file
+/// @copyright Copyright (c) 2023. MIT License.
+///
+#include "perception/lifecycle/node_metrics.h"
+
+#include <json.hpp>
+
+namespace perception
+{
+namespace lifecycle
+{
+namespace
+{
+/// @brief Converts latency histogram to JSON (latencies in nanoseconds)
+///
+/// @param histogram [in] - Latency histogram
+///
+/// @return JSON object with count, p50, p99, p999 and max latencies
+nlohmann::json ToJson(const LatencyHistogram& histogram)
+{
+    return nlohmann::json{{"count", histogram.GetCount()},
+                          {"p50_ns", histogram.GetPercentile(50.0).count()},
+                          {"p99_ns", histogram.GetPercentile(99.0).count()},
+                          {"p999_ns", histogram.GetPercentile(99.9).count()},
+                          {"max_ns", histogram.GetMax().count()}};
+}
+}  // namespace
+
+void DumpMetrics(const NodeMetricsMap& node_metrics, std::ostream& stream)
+{
+    nlohmann::json metrics = nlohmann::json::object();
+    for (const auto& node : node_metrics)
+    {
+        metrics[node.first] = nlohmann::json{{"init", ToJson(node.second.init_latency)},
+                                             {"step", ToJson(node.second.step_latency)},
+                                             {"shutdown", ToJson(node.second.shutdown_latency)},
+                                             {"overruns", node.second.number_of_overruns.load()}};
+    }
+    stream << metrics.dump();
+}
+
+}  // namespace lifecycle
+}  // namespace perception
@@ -0,0 +1,67 @@
+///
+/// @file
+/// @copyright Copyright (c) 2023. MIT License.
+///
+#ifndef PERCEPTION_LIFECYCLE_NODE_METRICS_H
+#define PERCEPTION_LIFECYCLE_NODE_METRICS_H
+
+#include "perception/lifecycle/latency_histogram.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <string>
+
+namespace perception
+{
+namespace lifecycle
+{
+
+/// @brief Latency metrics collected by the node runner for a single node
+struct NodeMetrics
+{
+    /// @brief Latency of INode::Init()
+    LatencyHistogram init_latency{};
+
+    /// @brief Latency of INode::Step()
+    LatencyHistogram step_latency{};
+
+    /// @brief Latency of INode::Shutdown()
+    LatencyHistogram shutdown_latency{};
+
+    /// @brief Number of steps, which overran their cycle duration
+    std::atomic<std::int64_t> number_of_overruns{0};
+};
+
+/// @brief Node Metrics per registered node (by node name)
+using NodeMetricsMap = std::map<std::string, NodeMetrics>;
+
+/// @brief Invoke provided callable and record its latency
+///
+/// @param histogram [in/out] - Histogram to record latency into
+/// @param callable [in] - Callable to be measured
+///
+/// @return measured latency
+template <typename Callable>
+std::chrono::nanoseconds RecordLatency(LatencyHistogram& histogram, Callable&& callable)
+{
+    const auto start = std::chrono::steady_clock::now();
+    callable();
+    const auto latency = std::chrono::steady_clock::now() - start;
+    histogram.Record(latency);
+    return latency;
+}
+
+/// @brief Dump node metrics as JSON, i.e.
+/// {"<node>": {"init": {"count", "p50_ns", "p99_ns", "p999_ns", "max_ns"}, "step": {...}, "shutdown": {...},
+///             "overruns": <count>}}
+///
+/// @param node_metrics [in] - Node Metrics per registered node
+/// @param stream [out] - Stream to write JSON to
+void DumpMetrics(const NodeMetricsMap& node_metrics, std::ostream& stream);
+
+}  // namespace lifecycle
+}  // namespace perception
+#endif  /// PERCEPTION_LIFECYCLE_NODE_METRICS_H
@@ -5,27 +5,29 @@
 #include "perception/lifecycle/node_runner.h"
 
 #include <functional>
-#include <iostream>
 
 namespace perception
 {
 namespace lifecycle
 {
 
-NodeRunner::NodeRunner() : node_map_{} {}
+NodeRunner::NodeRunner() : node_map_{}, node_metrics_{} {}
 
 void NodeRunner::RegisterNode(NodePtr node)
 {
-    node_map_.emplace(node->GetName(), std::move(node));
+    const auto name = node->GetName();
+    node_map_.emplace(name, std::move(node));
+    node_metrics_[name];
 }
 
 void NodeRunner::RunOnce()
 {
     for (auto& node : node_map_)
     {
-        node.second.get()->Init();
-        node.second.get()->Step();
-        node.second.get()->Shutdown();
+        auto& metrics = node_metrics_[node.first];
+        RecordLatency(metrics.init_latency, [&node] { node.second->Init(); });
+        RecordLatency(metrics.step_latency, [&node] { node.second->Step(); });
+        RecordLatency(metrics.shutdown_latency, [&node] { node.second->Shutdown(); });
     }
 }
 
@@ -35,14 +37,17 @@ void NodeRunner::RunForDuration(const std::chrono::milliseconds duration, const
 
     for (auto& node : node_map_)
     {
-        node.second.get()->Init();
+        auto& metrics = node_metrics_[node.first];
+        RecordLatency(metrics.init_latency, [&node] { node.second->Init(); });
         for (auto time_passed = 0ms; time_passed < duration; time_passed += step)
         {
-            node.second.get()->Step();
-            std::cout << "Time passed: " << time_passed.count() << "ms, Duration: " << duration.count()
-                      << " ms, with step: " << step.count() << "ms." << std::endl;
+            const auto latency = RecordLatency(metrics.step_latency, [&node] { node.second->Step(); });
+            if (latency > step)
+            {
+                ++metrics.number_of_overruns;
+            }
         }
-        node.second.get()->Shutdown();
+        RecordLatency(metrics.shutdown_latency, [&node] { node.second->Shutdown(); });
     }
 }
 
@@ -51,5 +56,10 @@ bool NodeRunner::IsNodeRegistered(const std::string name) const
     return (node_map_.find(name) != node_map_.end());
 }
 
+void NodeRunner::DumpMetrics(std::ostream& stream) const
+{
+    lifecycle::DumpMetrics(node_metrics_, stream);
+}
+
 }  // namespace lifecycle
 }  // namespace perception
@@ -6,6 +6,7 @@
 #define PERCEPTION_LIFECYCLE_NODE_RUNNER_H
 
 #include "perception/lifecycle/i_node_runner.h"
+#include "perception/lifecycle/node_metrics.h"
 
 #include <map>
 
@@ -14,10 +15,10 @@ namespace perception
 namespace lifecycle
 {
 
-/// @brief Default Cycle Duration
-static constexpr std::chrono::milliseconds kDefaultCycleDuration{40UL};
-
 /// @brief Node Runner (middleware)
+///
+/// @note Nodes are run one after another on simulated time (i.e. without sleeping). Use PipelinedNodeRunner to step
+/// nodes at their real wall-clock cycle duration.
 class NodeRunner : public INodeRunner
 {
   public:
@@ -44,9 +45,17 @@ class NodeRunner : public INodeRunner
     /// @return True if node is registered with same name, otherwise False.
     bool IsNodeRegistered(const std::string name) const;
 
+    /// @brief Dump latency metrics (Init/Step/Shutdown percentiles, overruns) collected per node as JSON
+    ///
+    /// @param stream [out] - Stream to write metrics to
+    void DumpMetrics(std::ostream& stream) const override;
+
   private:
     /// @brief list of registered node
     std::map<std::string, NodePtr> node_map_;
+
+    /// @brief latency metrics per registered node
+    NodeMetricsMap node_metrics_;
 };
 
 }  // namespace lifecycle
@@ -0,0 +1,134 @@
+///
+/// @file
+/// @copyright Copyright (c) 2023. MIT License.
+///
+#include "perception/lifecycle/pipelined_node_runner.h"
+
+#include <functional>
+#include <thread>
+#include <vector>
+
+namespace perception
+{
+namespace lifecycle
+{
+
+PipelinedNodeRunner::PipelinedNodeRunner() : node_map_{}, node_metrics_{} {}
+
+void PipelinedNodeRunner::RegisterNode(NodePtr node)
+{
+    RegisterNode(std::move(node), std::chrono::milliseconds::zero());
+}
+
+void PipelinedNodeRunner::RegisterNode(NodePtr node,
+                                       const std::chrono::milliseconds cycle_duration,
+                                       const OverrunPolicy overrun_policy)
+{
+    const auto name = node->GetName();
+    node_map_.emplace(name, NodeContext{std::move(node), cycle_duration, overrun_policy, CycleStatistics{}});
+    node_metrics_[name];
+}
+
+void PipelinedNodeRunner::RunOnce()
+{
+    InitNodes();
+
+    std::vector<std::thread> workers{};
+    workers.reserve(node_map_.size());
+    for (auto& node : node_map_)
+    {
+        auto& metrics = node_metrics_[node.first];
+        workers.emplace_back([&node, &metrics] {
+            RecordLatency(metrics.step_latency, [&node] { node.second.node->Step(); });
+        });
+    }
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+
+    ShutdownNodes();
+}
+
+void PipelinedNodeRunner::RunForDuration(const std::chrono::milliseconds duration,
+                                         const std::chrono::milliseconds step)
+{
+    InitNodes();
+
+    const auto start = CycleScheduler::Clock::now();
+    std::vector<std::thread> workers{};
+    workers.reserve(node_map_.size());
+    for (auto& node : node_map_)
+    {
+        const auto cycle_duration =
+            (node.second.cycle_duration > std::chrono::milliseconds::zero()) ? node.second.cycle_duration : step;
+        workers.emplace_back(&PipelinedNodeRunner::StepForDuration,
+                             std::ref(node.second),
+                             std::ref(node_metrics_[node.first]),
+                             start,
+                             duration,
+                             cycle_duration);
+    }
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+
+    ShutdownNodes();
+}
+
+bool PipelinedNodeRunner::IsNodeRegistered(const std::string name) const
+{
+    return (node_map_.find(name) != node_map_.end());
+}
+
+CycleStatistics PipelinedNodeRunner::GetCycleStatistics(const std::string name) const
+{
+    const auto node = node_map_.find(name);
+    return ((node != node_map_.end()) ? node->second.cycle_statistics : CycleStatistics{});
+}
+
+void PipelinedNodeRunner::DumpMetrics(std::ostream& stream) const
+{
+    lifecycle::DumpMetrics(node_metrics_, stream);
+}
+
+void PipelinedNodeRunner::InitNodes()
+{
+    for (auto& node : node_map_)
+    {
+        RecordLatency(node_metrics_[node.first].init_latency, [&node] { node.second.node->Init(); });
+    }
+}
+
+void PipelinedNodeRunner::ShutdownNodes()
+{
+    for (auto& node : node_map_)
+    {
+        RecordLatency(node_metrics_[node.first].shutdown_latency, [&node] { node.second.node->Shutdown(); });
+    }
+}
+
+void PipelinedNodeRunner::StepForDuration(NodeContext& node_context,
+                                          NodeMetrics& metrics,
+                                          const CycleScheduler::Clock::time_point start,
+                                          const std::chrono::milliseconds duration,
+                                          const std::chrono::milliseconds cycle_duration)
+{
+    const auto end = start + duration;
+    CycleScheduler scheduler{cycle_duration, node_context.overrun_policy};
+    scheduler.Start(start);
+    while (scheduler.GetNextReleaseTime() < end)
+    {
+        scheduler.WaitForNextCycle();
+        RecordLatency(metrics.step_latency, [&node_context] { node_context.node->Step(); });
+        if (scheduler.OnCycleFinished(CycleScheduler::Clock::now()))
+        {
+            ++metrics.number_of_overruns;
+        }
+    }
+    node_context.cycle_statistics = scheduler.GetCycleStatistics();
+}
+
+}  // namespace lifecycle
+}  // namespace perception
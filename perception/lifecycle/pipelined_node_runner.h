@@ -0,0 +1,117 @@
+///
+/// @file
+/// @copyright Copyright (c) 2023. MIT License.
+///
+#ifndef PERCEPTION_LIFECYCLE_PIPELINED_NODE_RUNNER_H
+#define PERCEPTION_LIFECYCLE_PIPELINED_NODE_RUNNER_H
+
+#include "perception/lifecycle/cycle_scheduler.h"
+#include "perception/lifecycle/i_node_runner.h"
+#include "perception/lifecycle/node_metrics.h"
+
+#include <chrono>
+#include <map>
+
+namespace perception
+{
+namespace lifecycle
+{
+
+/// @brief Pipelined Node Runner (middleware)
+///
+/// @note Each registered node is stepped on its own worker thread at its own cycle rate, hence stages of a pipeline
+/// (i.e. camera -> object -> driver) overlap and throughput follows the slowest stage instead of the sum of all stages.
+/// Nodes are expected to exchange data through lifecycle::BoundedQueue. Each node is released on its own wall-clock
+/// cycle grid by lifecycle::CycleScheduler.
+class PipelinedNodeRunner : public INodeRunner
+{
+  public:
+    /// @brief Default Constructor
+    PipelinedNodeRunner();
+
+    /// @brief Register a Node, which will be stepped with the runner's step size
+    ///
+    /// @param node [in] - instance of the node to be run
+    void RegisterNode(NodePtr node) override;
+
+    /// @brief Register a Node, which will be stepped with its own cycle duration
+    ///
+    /// @param node [in] - instance of the node to be run
+    /// @param cycle_duration [in] - Duration interval for which node will be stepped.
+    /// @param overrun_policy [in] - Behavior once node's step overruns its cycle deadline
+    void RegisterNode(NodePtr node,
+                      const std::chrono::milliseconds cycle_duration,
+                      const OverrunPolicy overrun_policy = OverrunPolicy::kSkip);
+
+    /// @brief Run all nodes once (nodes are stepped concurrently)
+    void RunOnce() override;
+
+    /// @brief Run all nodes concurrently for provided duration.
+    ///
+    /// @param duration [in] - Duration for which nodes will continue to run
+    /// @param step [in] - Duration interval for which nodes without own cycle duration will be stepped.
+    void RunForDuration(const std::chrono::milliseconds duration,
+                        const std::chrono::milliseconds step = kDefaultCycleDuration) override;
+
+    /// @brief Provide whether node is registered with the name provided
+    ///
+    /// @return True if node is registered with same name, otherwise False.
+    bool IsNodeRegistered(const std::string name) const;
+
+    /// @brief Provide cycle statistics (overruns, jitter) of the last run for the node with the name provided
+    ///
+    /// @return cycle statistics of the node, if registered, otherwise empty statistics
+    CycleStatistics GetCycleStatistics(const std::string name) const;
+
+    /// @brief Dump latency metrics (Init/Step/Shutdown percentiles, overruns) collected per node as JSON
+    /// @note Metrics are collected lock-free, hence may be dumped while nodes are running.
+    ///
+    /// @param stream [out] - Stream to write metrics to
+    void DumpMetrics(std::ostream& stream) const override;
+
+  private:
+    /// @brief Registered node along with its cycle duration
+    struct NodeContext
+    {
+        /// @brief Instance of the node
+        NodePtr node;
+
+        /// @brief Cycle duration of the node (0ms, to use runner's step size)
+        std::chrono::milliseconds cycle_duration;
+
+        /// @brief Behavior once node's step overruns its cycle deadline
+        OverrunPolicy overrun_policy;
+
+        /// @brief Cycle statistics collected during the last run
+        CycleStatistics cycle_statistics;
+    };
+
+    /// @brief Initialize all the registered nodes
+    void InitNodes();
+
+    /// @brief Shutdown all the registered nodes
+    void ShutdownNodes();
+
+    /// @brief Step node at its cycle rate, until duration is passed (executed on the worker thread)
+    ///
+    /// @param node_context [in/out] - Node to be stepped, along with its scheduling parameters and statistics
+    /// @param metrics [in/out] - Latency metrics of the node
+    /// @param start [in] - Time point of the first cycle (shared among all the workers)
+    /// @param duration [in] - Duration for which node will continue to run
+    /// @param cycle_duration [in] - Duration interval for which node will be stepped.
+    static void StepForDuration(NodeContext& node_context,
+                                NodeMetrics& metrics,
+                                const CycleScheduler::Clock::time_point start,
+                                const std::chrono::milliseconds duration,
+                                const std::chrono::milliseconds cycle_duration);
+
+    /// @brief list of registered node
+    std::map<std::string, NodeContext> node_map_;
+
+    /// @brief latency metrics per registered node
+    NodeMetricsMap node_metrics_;
+};
+
+}  // namespace lifecycle
+}  // namespace perception
+#endif  /// PERCEPTION_LIFECYCLE_PIPELINED_NODE_RUNNER_H
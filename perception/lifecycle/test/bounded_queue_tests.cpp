@@ -0,0 +1,127 @@
+///
+/// @file
+/// @copyright Copyright (c) 2023. MIT License.
+///
+#include "perception/lifecycle/bounded_queue.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <thread>
+
+namespace perception
+{
+namespace lifecycle
+{
+namespace
+{
+
+TEST(BoundedQueueTest, DefaultConstructor_ExpectEmptyQueue)
+{
+    // Given
+    const BoundedQueue<std::int32_t, 4U> queue{};
+
+    // Then
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.full());
+    EXPECT_EQ(queue.size(), 0U);
+    EXPECT_EQ(queue.capacity(), 4U);
+}
+
+TEST(BoundedQueueTest, TryPush_GivenTypicalValues_ExpectFirstInFirstOut)
+{
+    // Given
+    BoundedQueue<std::int32_t, 4U> queue{};
+
+    // When
+    ASSERT_TRUE(queue.try_push(1));
+    ASSERT_TRUE(queue.try_push(2));
+    ASSERT_TRUE(queue.try_push(3));
+
+    // Then
+    std::int32_t value{0};
+    EXPECT_EQ(queue.size(), 3U);
+    EXPECT_TRUE(queue.try_pop(value));
+    EXPECT_EQ(value, 1);
+    EXPECT_TRUE(queue.try_pop(value));
+    EXPECT_EQ(value, 2);
+    EXPECT_TRUE(queue.try_pop(value));
+    EXPECT_EQ(value, 3);
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(BoundedQueueTest, TryPush_GivenFullQueue_ExpectRejectedValue)
+{
+    // Given
+    BoundedQueue<std::int32_t, 2U> queue{};
+    ASSERT_TRUE(queue.try_push(1));
+    ASSERT_TRUE(queue.try_push(2));
+    ASSERT_TRUE(queue.full());
+
+    // When
+    const auto result = queue.try_push(3);
+
+    // Then
+    EXPECT_FALSE(result);
+    EXPECT_EQ(queue.size(), 2U);
+}
+
+TEST(BoundedQueueTest, TryPop_GivenEmptyQueue_ExpectUnchangedValue)
+{
+    // Given
+    BoundedQueue<std::int32_t, 2U> queue{};
+    std::int32_t value{42};
+
+    // When
+    const auto result = queue.try_pop(value);
+
+    // Then
+    EXPECT_FALSE(result);
+    EXPECT_EQ(value, 42);
+}
+
+TEST(BoundedQueueTest, TryPush_GivenSeparateProducerConsumerThreads_ExpectOrderedHandOff)
+{
+    // Given
+    constexpr std::int32_t kNumberOfValues{10000};
+    BoundedQueue<std::int32_t, 8U> queue{};
+
+    // When
+    std::thread producer{[&queue] {
+        for (std::int32_t value = 0; value < kNumberOfValues;)
+        {
+            if (queue.try_push(value))
+            {
+                ++value;
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+    }};
+
+    std::int32_t expected{0};
+    while (expected < kNumberOfValues)
+    {
+        std::int32_t value{-1};
+        if (queue.try_pop(value))
+        {
+            EXPECT_EQ(value, expected);
+            ++expected;
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+
+    // Then
+    EXPECT_TRUE(queue.empty());
+}
+
+}  // namespace
+}  // namespace lifecycle
+}  // namespace perception
@@ -0,0 +1,180 @@
+///
+/// @file
+/// @copyright Copyright (c) 2023. MIT License.
+///
+#include "perception/lifecycle/cycle_scheduler.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+namespace perception
+{
+namespace lifecycle
+{
+namespace
+{
+using namespace std::chrono_literals;
+
+constexpr std::chrono::milliseconds kTestCycleDuration{40ms};
+
+class CycleSchedulerFixture : public ::testing::TestWithParam<OverrunPolicy>
+{
+  public:
+    CycleSchedulerFixture() : start_{CycleScheduler::Clock::now()}, unit_{kTestCycleDuration, GetParam()} {}
+
+  protected:
+    void SetUp() override { unit_.Start(start_); }
+
+    void RunCycle(const std::chrono::nanoseconds start_delay, const std::chrono::nanoseconds step_duration)
+    {
+        const auto started = unit_.GetNextReleaseTime() + start_delay;
+        unit_.OnCycleStarted(started);
+        unit_.OnCycleFinished(started + step_duration);
+    }
+
+    const CycleScheduler::Clock::time_point start_;
+    CycleScheduler unit_;
+};
+
+TEST_P(CycleSchedulerFixture, OnCycleFinished_GivenStepWithinDeadline_ExpectNextReleaseOnCycleGrid)
+{
+    // When
+    RunCycle(1ms, 10ms);
+    RunCycle(2ms, 10ms);
+
+    // Then
+    const auto& actual = unit_.GetCycleStatistics();
+    EXPECT_EQ(unit_.GetNextReleaseTime(), start_ + 2 * kTestCycleDuration);
+    EXPECT_EQ(unit_.GetCycleDuration(), kTestCycleDuration);
+    EXPECT_EQ(actual.number_of_cycles, 2);
+    EXPECT_EQ(actual.number_of_overruns, 0);
+    EXPECT_EQ(actual.number_of_skipped_cycles, 0);
+    EXPECT_EQ(actual.max_jitter, 2ms);
+    EXPECT_EQ(actual.total_jitter, 3ms);
+}
+
+TEST_P(CycleSchedulerFixture, OnCycleFinished_GivenStepExceedingDeadline_ExpectOverrun)
+{
+    // When
+    RunCycle(0ms, 100ms);
+
+    // Then
+    EXPECT_EQ(unit_.GetCycleStatistics().number_of_overruns, 1);
+}
+
+INSTANTIATE_TEST_SUITE_P(CycleScheduler,
+                         CycleSchedulerFixture,
+                         ::testing::Values(OverrunPolicy::kSkip, OverrunPolicy::kCatchUp, OverrunPolicy::kDegrade));
+
+TEST(CycleSchedulerTest, OnCycleFinished_GivenSkipPolicyWithOverrun_ExpectMissedCyclesSkipped)
+{
+    // Given
+    const auto start = CycleScheduler::Clock::now();
+    CycleScheduler unit{kTestCycleDuration, OverrunPolicy::kSkip};
+    unit.Start(start);
+
+    // When
+    unit.OnCycleStarted(start);
+    unit.OnCycleFinished(start + 100ms);
+
+    // Then
+    EXPECT_EQ(unit.GetNextReleaseTime(), start + 3 * kTestCycleDuration);
+    EXPECT_EQ(unit.GetCycleStatistics().number_of_skipped_cycles, 2);
+}
+
+TEST(CycleSchedulerTest, OnCycleFinished_GivenCatchUpPolicyWithOverrun_ExpectMissedCyclesReleasedImmediately)
+{
+    // Given
+    const auto start = CycleScheduler::Clock::now();
+    CycleScheduler unit{kTestCycleDuration, OverrunPolicy::kCatchUp};
+    unit.Start(start);
+
+    // When
+    unit.OnCycleStarted(start);
+    unit.OnCycleFinished(start + 100ms);
+
+    // Then
+    EXPECT_EQ(unit.GetNextReleaseTime(), start + kTestCycleDuration);
+    EXPECT_EQ(unit.GetCycleStatistics().number_of_skipped_cycles, 0);
+}
+
+TEST(CycleSchedulerTest, OnCycleFinished_GivenDegradePolicyWithOverrun_ExpectStretchedCycleDuration)
+{
+    // Given
+    const auto start = CycleScheduler::Clock::now();
+    CycleScheduler unit{kTestCycleDuration, OverrunPolicy::kDegrade};
+    unit.Start(start);
+
+    // When
+    unit.OnCycleStarted(start);
+    unit.OnCycleFinished(start + 50ms);
+
+    // Then
+    EXPECT_EQ(unit.GetNextReleaseTime(), start + 50ms);
+    EXPECT_EQ(unit.GetCycleDuration(), 2 * kTestCycleDuration);
+}
+
+TEST(CycleSchedulerTest, OnCycleFinished_GivenDegradePolicyWithRecoveredStep_ExpectNominalCycleDuration)
+{
+    // Given
+    const auto start = CycleScheduler::Clock::now();
+    CycleScheduler unit{kTestCycleDuration, OverrunPolicy::kDegrade};
+    unit.Start(start);
+    unit.OnCycleStarted(start);
+    unit.OnCycleFinished(start + 50ms);
+    ASSERT_EQ(unit.GetCycleDuration(), 2 * kTestCycleDuration);
+
+    // When
+    unit.OnCycleStarted(start + 50ms);
+    unit.OnCycleFinished(start + 60ms);
+
+    // Then
+    EXPECT_EQ(unit.GetNextReleaseTime(), start + 50ms + 2 * kTestCycleDuration);
+    EXPECT_EQ(unit.GetCycleDuration(), kTestCycleDuration);
+}
+
+TEST(CycleSchedulerTest, OnCycleFinished_GivenDegradePolicyWithRepeatedOverruns_ExpectLimitedCycleDuration)
+{
+    // Given
+    const auto start = CycleScheduler::Clock::now();
+    CycleScheduler unit{kTestCycleDuration, OverrunPolicy::kDegrade};
+    unit.Start(start);
+
+    // When
+    for (auto cycle = 0; cycle < 10; ++cycle)
+    {
+        const auto started = unit.GetNextReleaseTime();
+        unit.OnCycleStarted(started);
+        unit.OnCycleFinished(started + 1s);
+    }
+
+    // Then
+    EXPECT_EQ(unit.GetCycleDuration(), CycleScheduler::kMaxDegradationFactor * kTestCycleDuration);
+}
+
+TEST(CycleSchedulerTest, Constructor_GivenZeroCycleDuration_ExpectDeath)
+{
+    ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+    EXPECT_DEATH(CycleScheduler(0ms, OverrunPolicy::kSkip), "Cycle duration must be positive");
+}
+
+TEST(CycleSchedulerTest, WaitForNextCycle_ExpectSleepUntilReleaseTime)
+{
+    // Given
+    const auto start = CycleScheduler::Clock::now() + 10ms;
+    CycleScheduler unit{kTestCycleDuration, OverrunPolicy::kSkip};
+    unit.Start(start);
+
+    // When
+    unit.WaitForNextCycle();
+
+    // Then
+    EXPECT_GE(CycleScheduler::Clock::now(), start);
+    EXPECT_EQ(unit.GetCycleStatistics().number_of_cycles, 1);
+}
+
+}  // namespace
+}  // namespace lifecycle
+}  // namespace perception
@@ -0,0 +1,116 @@
+///
+/// @file
+/// @copyright Copyright (c) 2023. MIT License.
+///
+#include "perception/lifecycle/latency_histogram.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace perception
+{
+namespace lifecycle
+{
+namespace
+{
+using namespace std::chrono_literals;
+
+TEST(LatencyHistogramTest, DefaultConstructor_ExpectEmptyHistogram)
+{
+    // Given
+    const LatencyHistogram unit{};
+
+    // Then
+    EXPECT_EQ(unit.GetCount(), 0);
+    EXPECT_EQ(unit.GetMax(), 0ns);
+    EXPECT_EQ(unit.GetPercentile(50.0), 0ns);
+}
+
+TEST(LatencyHistogramTest, Record_GivenSmallLatencies_ExpectExactPercentiles)
+{
+    // Given
+    LatencyHistogram unit{};
+
+    // When
+    for (std::int64_t latency = 1; latency <= 10; ++latency)
+    {
+        unit.Record(std::chrono::nanoseconds{latency});
+    }
+
+    // Then
+    EXPECT_EQ(unit.GetCount(), 10);
+    EXPECT_EQ(unit.GetPercentile(50.0), 5ns);
+    EXPECT_EQ(unit.GetPercentile(99.0), 10ns);
+    EXPECT_EQ(unit.GetMax(), 10ns);
+}
+
+TEST(LatencyHistogramTest, Record_GivenTailLatency_ExpectTailOnlyInHighPercentiles)
+{
+    // Given
+    LatencyHistogram unit{};
+
+    // When
+    for (auto i = 0; i < 999; ++i)
+    {
+        unit.Record(1ms);
+    }
+    unit.Record(40ms);
+
+    // Then
+    using Milliseconds = std::chrono::duration<double, std::milli>;
+    EXPECT_NEAR(Milliseconds{unit.GetPercentile(50.0)}.count(), 1.0, 0.07);
+    EXPECT_NEAR(Milliseconds{unit.GetPercentile(99.0)}.count(), 1.0, 0.07);
+    EXPECT_EQ(unit.GetPercentile(100.0), 40ms);
+    EXPECT_EQ(unit.GetMax(), 40ms);
+}
+
+TEST(LatencyHistogramTest, Reset_ExpectEmptyHistogram)
+{
+    // Given
+    LatencyHistogram unit{};
+    unit.Record(1ms);
+
+    // When
+    unit.Reset();
+
+    // Then
+    EXPECT_EQ(unit.GetCount(), 0);
+    EXPECT_EQ(unit.GetMax(), 0ns);
+}
+
+TEST(LatencyHistogramTest, Record_GivenConcurrentWriters_ExpectAllLatenciesRecorded)
+{
+    // Given
+    constexpr std::int32_t kNumberOfWriters{4};
+    constexpr std::int32_t kNumberOfRecords{1000};
+    LatencyHistogram unit{};
+
+    // When
+    std::vector<std::thread> writers{};
+    for (auto writer = 0; writer < kNumberOfWriters; ++writer)
+    {
+        writers.emplace_back([&unit] {
+            for (auto i = 0; i < kNumberOfRecords; ++i)
+            {
+                unit.Record(std::chrono::microseconds{i});
+            }
+        });
+    }
+    for (auto& writer : writers)
+    {
+        writer.join();
+    }
+
+    // Then
+    EXPECT_EQ(unit.GetCount(), kNumberOfWriters * kNumberOfRecords);
+    EXPECT_EQ(unit.GetMax(), std::chrono::microseconds{kNumberOfRecords - 1});
+}
+
+}  // namespace
+}  // namespace lifecycle
+}  // namespace perception
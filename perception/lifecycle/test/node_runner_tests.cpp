@@ -7,8 +7,10 @@
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <json.hpp>
 
 #include <memory>
+#include <sstream>
 
 namespace perception
 {
@@ -91,6 +93,30 @@ TEST_F(NodeRunnerFixture, RunForDuration_ExpectNodeStepMultipleTimes)
     // When
     runner_.RunForDuration(kTestDuration);
 }
+
+TEST_F(NodeRunnerFixture, DumpMetrics_GivenRunForDuration_ExpectLatencyMetricsPerNode)
+{
+    // Given
+    constexpr std::chrono::milliseconds kTestDuration{120UL};
+    EXPECT_CALL(*mocked_node_ptr_, Init()).Times(1);
+    EXPECT_CALL(*mocked_node_ptr_, Step()).Times(3);
+    EXPECT_CALL(*mocked_node_ptr_, Shutdown()).Times(1);
+    runner_.RunForDuration(kTestDuration);
+
+    // When
+    std::stringstream stream{};
+    runner_.DumpMetrics(stream);
+
+    // Then
+    const auto actual = nlohmann::json::parse(stream.str());
+    ASSERT_TRUE(actual.contains(node_name_));
+    EXPECT_EQ(actual[node_name_]["init"]["count"], 1);
+    EXPECT_EQ(actual[node_name_]["step"]["count"], 3);
+    EXPECT_EQ(actual[node_name_]["shutdown"]["count"], 1);
+    EXPECT_EQ(actual[node_name_]["overruns"], 0);
+    EXPECT_LE(actual[node_name_]["step"]["p50_ns"], actual[node_name_]["step"]["max_ns"]);
+    EXPECT_LE(actual[node_name_]["step"]["p999_ns"], actual[node_name_]["step"]["max_ns"]);
+}
 }  // namespace
 }  // namespace lifecycle
 }  // namespace perception
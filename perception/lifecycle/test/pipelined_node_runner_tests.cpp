@@ -0,0 +1,175 @@
+///
+/// @file
+/// @copyright Copyright (c) 2023. MIT License.
+///
+#include "perception/lifecycle/pipelined_node_runner.h"
+#include "perception/lifecycle/test/support/mocks/node_mock.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <json.hpp>
+
+#include <atomic>
+#include <memory>
+#include <sstream>
+#include <thread>
+
+namespace perception
+{
+namespace lifecycle
+{
+namespace
+{
+using namespace std::chrono_literals;
+using ::testing::Invoke;
+using ::testing::Return;
+
+class PipelinedNodeRunnerFixture : public ::testing::Test
+{
+  public:
+    PipelinedNodeRunnerFixture()
+        : first_node_{std::make_unique<test::support::NodeMock>()},
+          second_node_{std::make_unique<test::support::NodeMock>()},
+          first_node_ptr_{first_node_.get()},
+          second_node_ptr_{second_node_.get()},
+          runner_{}
+    {
+    }
+
+  protected:
+    void SetUp() override
+    {
+        EXPECT_CALL(*first_node_ptr_, GetName()).WillRepeatedly(Return("first_node"));
+        EXPECT_CALL(*second_node_ptr_, GetName()).WillRepeatedly(Return("second_node"));
+    }
+
+    void RegisterNodes() { RegisterNodes(0ms); }
+    void RegisterNodes(const std::chrono::milliseconds second_node_cycle_duration)
+    {
+        runner_.RegisterNode(std::move(first_node_));
+        runner_.RegisterNode(std::move(second_node_), second_node_cycle_duration);
+    }
+
+    std::unique_ptr<test::support::NodeMock> first_node_;
+    std::unique_ptr<test::support::NodeMock> second_node_;
+    test::support::NodeMock* first_node_ptr_;
+    test::support::NodeMock* second_node_ptr_;
+    PipelinedNodeRunner runner_;
+};
+
+TEST_F(PipelinedNodeRunnerFixture, RegisterNode_ExpectRegisteredNodes)
+{
+    // Then
+    EXPECT_CALL(*first_node_ptr_, Init()).Times(0);
+    EXPECT_CALL(*first_node_ptr_, Step()).Times(0);
+    EXPECT_CALL(*first_node_ptr_, Shutdown()).Times(0);
+
+    // When
+    RegisterNodes();
+
+    // Then
+    EXPECT_TRUE(runner_.IsNodeRegistered("first_node"));
+    EXPECT_TRUE(runner_.IsNodeRegistered("second_node"));
+    EXPECT_FALSE(runner_.IsNodeRegistered("third_node"));
+}
+
+TEST_F(PipelinedNodeRunnerFixture, RunOnce_ExpectEachNodeStepOnce)
+{
+    // Given
+    RegisterNodes();
+
+    // Then
+    EXPECT_CALL(*first_node_ptr_, Init()).Times(1);
+    EXPECT_CALL(*first_node_ptr_, Step()).Times(1);
+    EXPECT_CALL(*first_node_ptr_, Shutdown()).Times(1);
+    EXPECT_CALL(*second_node_ptr_, Init()).Times(1);
+    EXPECT_CALL(*second_node_ptr_, Step()).Times(1);
+    EXPECT_CALL(*second_node_ptr_, Shutdown()).Times(1);
+
+    // When
+    runner_.RunOnce();
+}
+
+TEST_F(PipelinedNodeRunnerFixture, RunForDuration_GivenOwnCycleDuration_ExpectNodesSteppedAtOwnRate)
+{
+    // Given
+    constexpr std::chrono::milliseconds kTestDuration{120UL};
+    constexpr std::chrono::milliseconds kSecondNodeCycleDuration{20UL};
+    RegisterNodes(kSecondNodeCycleDuration);
+
+    // Then
+    constexpr std::int32_t first_node_times = kTestDuration / kDefaultCycleDuration;
+    constexpr std::int32_t second_node_times = kTestDuration / kSecondNodeCycleDuration;
+    EXPECT_CALL(*first_node_ptr_, Init()).Times(1);
+    EXPECT_CALL(*first_node_ptr_, Step()).Times(first_node_times);
+    EXPECT_CALL(*first_node_ptr_, Shutdown()).Times(1);
+    EXPECT_CALL(*second_node_ptr_, Init()).Times(1);
+    EXPECT_CALL(*second_node_ptr_, Step()).Times(second_node_times);
+    EXPECT_CALL(*second_node_ptr_, Shutdown()).Times(1);
+
+    // When
+    runner_.RunForDuration(kTestDuration);
+}
+
+TEST_F(PipelinedNodeRunnerFixture, RunForDuration_GivenSlowNodes_ExpectOverlappingSteps)
+{
+    // Given
+    std::atomic<std::int32_t> active_steps{0};
+    std::atomic<std::int32_t> max_active_steps{0};
+    const auto slow_step = [&active_steps, &max_active_steps] {
+        const auto active = ++active_steps;
+        auto max_active = max_active_steps.load();
+        while ((active > max_active) && !max_active_steps.compare_exchange_weak(max_active, active))
+        {
+        }
+        std::this_thread::sleep_for(20ms);
+        --active_steps;
+    };
+    EXPECT_CALL(*first_node_ptr_, Init()).Times(1);
+    EXPECT_CALL(*first_node_ptr_, Step()).WillRepeatedly(Invoke(slow_step));
+    EXPECT_CALL(*first_node_ptr_, Shutdown()).Times(1);
+    EXPECT_CALL(*second_node_ptr_, Init()).Times(1);
+    EXPECT_CALL(*second_node_ptr_, Step()).WillRepeatedly(Invoke(slow_step));
+    EXPECT_CALL(*second_node_ptr_, Shutdown()).Times(1);
+    RegisterNodes();
+
+    // When
+    runner_.RunForDuration(kDefaultCycleDuration);
+
+    // Then
+    EXPECT_EQ(max_active_steps.load(), 2);
+}
+
+TEST_F(PipelinedNodeRunnerFixture, RunForDuration_GivenStepExceedingCycleDuration_ExpectOverrunsAndSkippedCycles)
+{
+    // Given
+    constexpr std::chrono::milliseconds kTestDuration{100UL};
+    constexpr std::chrono::milliseconds kSecondNodeCycleDuration{20UL};
+    EXPECT_CALL(*first_node_ptr_, Init()).Times(1);
+    EXPECT_CALL(*first_node_ptr_, Step()).Times(::testing::AnyNumber());
+    EXPECT_CALL(*first_node_ptr_, Shutdown()).Times(1);
+    EXPECT_CALL(*second_node_ptr_, Init()).Times(1);
+    EXPECT_CALL(*second_node_ptr_, Step()).WillRepeatedly(Invoke([] { std::this_thread::sleep_for(30ms); }));
+    EXPECT_CALL(*second_node_ptr_, Shutdown()).Times(1);
+    RegisterNodes(kSecondNodeCycleDuration);
+
+    // When
+    runner_.RunForDuration(kTestDuration);
+
+    // Then
+    const auto actual = runner_.GetCycleStatistics("second_node");
+    EXPECT_GT(actual.number_of_overruns, 0);
+    EXPECT_GT(actual.number_of_skipped_cycles, 0);
+    EXPECT_LT(actual.number_of_cycles, kTestDuration / kSecondNodeCycleDuration);
+
+    std::stringstream stream{};
+    runner_.DumpMetrics(stream);
+    const auto metrics = nlohmann::json::parse(stream.str());
+    EXPECT_EQ(metrics["second_node"]["overruns"], actual.number_of_overruns);
+    EXPECT_EQ(metrics["second_node"]["step"]["count"], actual.number_of_cycles);
+    EXPECT_GE(metrics["second_node"]["step"]["p50_ns"], std::chrono::nanoseconds{30ms}.count());
+}
+
+}  // namespace
+}  // namespace lifecycle
+}  // namespace perception
@@ -227,11 +227,11 @@ const ObjectListMessage& Object::GetObjectListMessage() const
 
 void Object::UpdateOutputs()
 {
-    const auto results = inference_engine_.GetResults();
-    const cv::Mat detection_classes = results.at(0);
-    const cv::Mat detection_scores = results.at(1);
-    const cv::Mat detection_boxes = results.at(2);
-    const cv::Mat num_detections = results.at(3);
+    const auto& results = inference_engine_.GetResults();
+    const cv::Mat& detection_classes = results.at(0);
+    const cv::Mat& detection_scores = results.at(1);
+    const cv::Mat& detection_boxes = results.at(2);
+    const cv::Mat& num_detections = results.at(3);
 
     object_list_message_.number_of_valid_objects = 0;
     object_list_message_.time_point = camera_message_.time_point;
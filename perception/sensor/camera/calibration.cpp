@@ -11,15 +11,59 @@
 #include <opencv4/opencv2/core/hal/interface.h>
 #include <opencv4/opencv2/core/types.hpp>
 #include <opencv4/opencv2/imgcodecs.hpp>
+#include <opencv4/opencv2/imgproc.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <future>
 #include <iterator>
 #include <numeric>
+#include <string>
+#include <thread>
 
 namespace perception
 {
+namespace
+{
+/// @brief Version of calibration cache format (increment on changes, to invalidate existing caches)
+constexpr std::int32_t kCalibrationCacheVersion{1};
+
+/// @brief Half of the search window size for sub-pixel corner refinement
+const cv::Size kCornerRefinementWindowSize{11, 11};
+
+/// @brief FNV-1a 64-bit offset basis
+constexpr std::uint64_t kHashOffsetBasis{14695981039346656037ULL};
 
-Calibration::Calibration(const std::string dirname, const std::int32_t nx, const std::int32_t ny)
+/// @brief FNV-1a 64-bit prime
+constexpr std::uint64_t kHashPrime{1099511628211ULL};
+
+/// @brief Update FNV-1a hash with data
+///
+/// @param data [in] Data to be hashed
+/// @param size [in] Size of data (in bytes)
+/// @param hash [in/out] Hash to be updated
+void UpdateHash(const char* data, const std::size_t size, std::uint64_t& hash)
+{
+    for (std::size_t index = 0U; index < size; ++index)
+    {
+        hash ^= static_cast<std::uint8_t>(data[index]);
+        hash *= kHashPrime;
+    }
+}
+}  // namespace
+
+Calibration::Calibration(const std::string dirname,
+                         const std::int32_t nx,
+                         const std::int32_t ny,
+                         const std::string cache_filename)
     : filelist_{},
+      cache_filename_{cache_filename},
+      inputs_hash_{0U},
+      cached_{false},
+      root_mean_square_{0.0},
+      refine_corners_{false},
       pattern_size_{nx, ny},
       image_size_{},
       object_points_{},
@@ -34,6 +78,17 @@ Calibration::Calibration(const std::string dirname, const std::int32_t nx, const
 
 void Calibration::Init()
 {
+    if (!cache_filename_.empty())
+    {
+        inputs_hash_ = ComputeInputsHash();
+        cached_ = ReadCache();
+        if (cached_)
+        {
+            LOG(INFO) << "Found valid calibration cache " << cache_filename_ << ", skipping chessboard detection.";
+            return;
+        }
+    }
+
     std::vector<cv::Point3f> pattern_points{};
     for (std::int32_t w = 0; w < pattern_size_.width; ++w)
     {
@@ -43,37 +98,71 @@ void Calibration::Init()
         }
     }
 
-    /// @todo Use threads to improve performance.
-    for (const auto& filename : filelist_)
+    // images are independent, detect corners concurrently and collect them in filelist order (deterministic)
+    std::vector<ChessboardCorners> chessboard_corners(filelist_.size());
+    std::atomic<std::size_t> next_index{0U};
+    const auto detect_chessboard_corners = [this, &chessboard_corners, &next_index]() {
+        for (auto index = next_index++; index < filelist_.size(); index = next_index++)
+        {
+            chessboard_corners[index] = DetectChessboardCorners(filelist_[index]);
+        }
+    };
+
+    const auto number_of_threads = std::min(static_cast<std::size_t>(std::max(std::thread::hardware_concurrency(), 1U)),
+                                            std::max(filelist_.size(), std::size_t{1U}));
+    std::vector<std::future<void>> workers{};
+    for (std::size_t worker = 1U; worker < number_of_threads; ++worker)
+    {
+        workers.push_back(std::async(std::launch::async, detect_chessboard_corners));
+    }
+    detect_chessboard_corners();
+    for (auto& worker : workers)
     {
-        const cv::Mat image = cv::imread(filename, cv::IMREAD_GRAYSCALE);
-        image_size_ = image.size();
-
-        std::vector<cv::Point2f> corners{};
-        if (!cv::findChessboardCorners(
-                image,
-                pattern_size_,
-                corners,
-                cv::CALIB_CB_FAST_CHECK | cv::CALIB_CB_NORMALIZE_IMAGE | cv::CALIB_CB_ADAPTIVE_THRESH))
+        worker.get();
+    }
+
+    for (const auto& corners : chessboard_corners)
+    {
+        image_size_ = corners.image_size;
+        if (!corners.found)
         {
             continue;
         }
 
-        image_points_.push_back(corners);
+        image_points_.push_back(corners.corners);
         object_points_.push_back(pattern_points);
     }
+
+    LOG(INFO) << "Detected chessboard corners in " << image_points_.size() << " of " << filelist_.size()
+              << " calibration images (" << number_of_threads << " threads).";
 }
 void Calibration::Execute()
 {
-    const double root_mean_square = cv::calibrateCamera(
+    if (cached_)
+    {
+        LOG(INFO) << "Root Mean Square (RMS) Error reported from calibration cache for CAMERA: " << root_mean_square_;
+        return;
+    }
+
+    root_mean_square_ = cv::calibrateCamera(
         object_points_, image_points_, image_size_, camera_matrix_, distance_coefficients_, rotation_, translation_);
 
     LOG(INFO) << "Root Mean Square (RMS) Error reported after calibrating " << filelist_.size()
-              << " images for CAMERA: " << root_mean_square;
+              << " images for CAMERA: " << root_mean_square_;
+
+    if (!cache_filename_.empty())
+    {
+        WriteCache();
+    }
 }
 
 void Calibration::Shutdown() {}
 
+void Calibration::SetCornerRefinement(const bool refine_corners)
+{
+    refine_corners_ = refine_corners;
+}
+
 const cv::Mat& Calibration::GetCameraMatrix() const
 {
     return camera_matrix_;
@@ -94,4 +183,143 @@ const cv::Mat& Calibration::GetTranslationMatrix() const
     return translation_;
 }
 
+double Calibration::GetRootMeanSquareError() const
+{
+    return root_mean_square_;
+}
+
+Calibration::ChessboardCorners Calibration::DetectChessboardCorners(const std::string& filename) const
+{
+    const cv::Mat image = cv::imread(filename, cv::IMREAD_GRAYSCALE);
+
+    ChessboardCorners chessboard_corners{};
+    chessboard_corners.image_size = image.size();
+    chessboard_corners.found = cv::findChessboardCorners(
+        image,
+        pattern_size_,
+        chessboard_corners.corners,
+        cv::CALIB_CB_FAST_CHECK | cv::CALIB_CB_NORMALIZE_IMAGE | cv::CALIB_CB_ADAPTIVE_THRESH);
+
+    if (chessboard_corners.found && refine_corners_)
+    {
+        cv::cornerSubPix(image,
+                         chessboard_corners.corners,
+                         kCornerRefinementWindowSize,
+                         cv::Size{-1, -1},
+                         cv::TermCriteria{cv::TermCriteria::EPS + cv::TermCriteria::COUNT, 30, 0.001});
+    }
+    return chessboard_corners;
+}
+
+std::uint64_t Calibration::ComputeInputsHash() const
+{
+    std::uint64_t hash{kHashOffsetBasis};
+    UpdateHash(reinterpret_cast<const char*>(&pattern_size_.width), sizeof(pattern_size_.width), hash);
+    UpdateHash(reinterpret_cast<const char*>(&pattern_size_.height), sizeof(pattern_size_.height), hash);
+    UpdateHash(reinterpret_cast<const char*>(&refine_corners_), sizeof(refine_corners_), hash);
+
+    std::vector<char> buffer(64U * 1024U);
+    for (const auto& filename : filelist_)
+    {
+        UpdateHash(filename.data(), filename.size(), hash);
+
+        std::ifstream file{filename, std::ios::binary};
+        while (file)
+        {
+            file.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            UpdateHash(buffer.data(), static_cast<std::size_t>(file.gcount()), hash);
+        }
+    }
+    return hash;
+}
+
+bool Calibration::ReadCache()
+{
+    // cv::FileStorage throws on malformed (e.g. partially written) files, which are treated as invalid cache
+    try
+    {
+        const cv::FileStorage cache{cache_filename_, cv::FileStorage::READ};
+        if (!cache.isOpened())
+        {
+            return false;
+        }
+
+        const auto version = static_cast<std::int32_t>(cache["version"]);
+        const auto inputs_hash = static_cast<std::string>(cache["inputs_hash"]);
+        if ((version != kCalibrationCacheVersion) || (inputs_hash != std::to_string(inputs_hash_)))
+        {
+            LOG(INFO) << "Calibration cache " << cache_filename_ << " is outdated (version " << version
+                      << ", inputs hash " << inputs_hash << "), recalibrating.";
+            return false;
+        }
+
+        cv::Size image_size{};
+        cv::Mat camera_matrix{};
+        cv::Mat distance_coefficients{};
+        cv::Mat rotation{};
+        cv::Mat translation{};
+        double root_mean_square{0.0};
+        cache["image_size"] >> image_size;
+        cache["camera_matrix"] >> camera_matrix;
+        cache["distance_coefficients"] >> distance_coefficients;
+        cache["rotation"] >> rotation;
+        cache["translation"] >> translation;
+        cache["root_mean_square"] >> root_mean_square;
+        if (camera_matrix.empty() || distance_coefficients.empty())
+        {
+            LOG(WARNING) << "Calibration cache " << cache_filename_ << " is incomplete, recalibrating.";
+            return false;
+        }
+
+        image_size_ = image_size;
+        camera_matrix_ = camera_matrix;
+        distance_coefficients_ = distance_coefficients;
+        rotation_ = rotation;
+        translation_ = translation;
+        root_mean_square_ = root_mean_square;
+        return true;
+    }
+    catch (const cv::Exception& exception)
+    {
+        LOG(WARNING) << "Unable to read calibration cache " << cache_filename_ << " (" << exception.what()
+                     << "), recalibrating.";
+        return false;
+    }
+}
+
+void Calibration::WriteCache() const
+{
+    // written next to the cache and renamed once complete, so that readers (e.g. concurrent starts) never see a
+    // partially written cache
+    const std::string temporary_filename{cache_filename_ + ".tmp"};
+    {
+        cv::FileStorage cache{temporary_filename, cv::FileStorage::WRITE};
+        if (!cache.isOpened())
+        {
+            LOG(WARNING) << "Unable to write calibration cache " << cache_filename_ << ", calibrating on next start.";
+            return;
+        }
+
+        cache << "version" << kCalibrationCacheVersion;
+        // stored as string, since cv::FileStorage does not support 64-bit integers
+        cache << "inputs_hash" << std::to_string(inputs_hash_);
+        cache << "image_size" << image_size_;
+        cache << "camera_matrix" << camera_matrix_;
+        cache << "distance_coefficients" << distance_coefficients_;
+        cache << "rotation" << rotation_;
+        cache << "translation" << translation_;
+        cache << "root_mean_square" << root_mean_square_;
+        cache.release();
+    }
+
+    if (std::rename(temporary_filename.c_str(), cache_filename_.c_str()) != 0)
+    {
+        LOG(WARNING) << "Unable to replace calibration cache " << cache_filename_ << ", calibrating on next start.";
+        std::remove(temporary_filename.c_str());
+        return;
+    }
+
+    LOG(INFO) << "Written calibration cache " << cache_filename_ << ".";
+}
+
 }  // namespace perception
@@ -21,17 +21,30 @@ class Calibration
     /// @param dirname  [in] Directory path/name containing calibration images (chessboard images)
     /// @param nx  [in] Number of chessboard blocks in X-axes
     /// @param ny  [in] Number of chessboard blocks in Y-axes
-    explicit Calibration(const std::string dirname, const std::int32_t nx, const std::int32_t ny);
+    /// @param cache_filename  [in] File to persist calibration results to (empty string disables caching)
+    explicit Calibration(const std::string dirname,
+                         const std::int32_t nx,
+                         const std::int32_t ny,
+                         const std::string cache_filename);
 
     /// @brief Initialize Calibration. Prepare image points and object points for Calibration
+    /// @note Skipped, if calibration cache is valid for the calibration images and chessboard pattern (calibration
+    /// results are read from the cache instead)
     void Init();
 
     /// @brief Executes Calibration with collected image points and object points
+    /// @note Skipped, if calibration results have been read from cache by Init, otherwise calibrates and updates the
+    /// cache
     void Execute();
 
     /// @brief Release resources used for calibration
     void Shutdown();
 
+    /// @brief Enable sub-pixel refinement of detected chessboard corners (cv::cornerSubPix), to be set before Init
+    ///
+    /// @param refine_corners [in] Refine corners (default: false)
+    void SetCornerRefinement(const bool refine_corners);
+
     /// @brief Provides Camera Calibration Parameters [Camera Matrix]
     const cv::Mat& GetCameraMatrix() const;
 
@@ -44,10 +57,63 @@ class Calibration
     /// @brief Provides Camera Calibration Parameters [Translation Matrix]
     const cv::Mat& GetTranslationMatrix() const;
 
+    /// @brief Provides Root Mean Square (RMS) re-projection error of the calibration (0, if not calibrated)
+    double GetRootMeanSquareError() const;
+
   private:
+    /// @brief Chessboard corners detected in a calibration image
+    struct ChessboardCorners
+    {
+        /// @brief Calibration image size
+        cv::Size image_size{};
+
+        /// @brief Chessboard pattern found in calibration image
+        bool found{false};
+
+        /// @brief Chessboard corners (2D)
+        std::vector<cv::Point2f> corners{};
+    };
+
+    /// @brief Detect chessboard corners in calibration image (thread-safe)
+    ///
+    /// @param filename [in] Calibration image filepath
+    ///
+    /// @return Detected chessboard corners
+    ChessboardCorners DetectChessboardCorners(const std::string& filename) const;
+
+    /// @brief Provides hash of calibration inputs (chessboard pattern and calibration images)
+    std::uint64_t ComputeInputsHash() const;
+
+    /// @brief Read calibration results from calibration cache, if it exists and has been created for the current
+    /// calibration inputs
+    ///
+    /// @note Calibration results are left unchanged, if the cache is invalid (e.g. outdated, truncated or malformed).
+    ///
+    /// @return True, if calibration results have been read from a valid calibration cache
+    bool ReadCache();
+
+    /// @brief Write calibration results to calibration cache (atomically, i.e. readers see either the previous or the
+    /// complete cache)
+    void WriteCache() const;
+
     /// @brief List of filepath (calibration images)
     std::vector<std::string> filelist_;
 
+    /// @brief Calibration cache filename
+    const std::string cache_filename_;
+
+    /// @brief Hash of calibration inputs, identifying calibration cache
+    std::uint64_t inputs_hash_;
+
+    /// @brief Calibration results are read from cache (i.e. calibration is skipped)
+    bool cached_;
+
+    /// @brief Root Mean Square (RMS) re-projection error of calibration
+    double root_mean_square_;
+
+    /// @brief Refine chessboard corners to sub-pixel accuracy
+    bool refine_corners_;
+
     /// @brief Chessboard Pattern Size (nx, ny)
     const cv::Size pattern_size_;
 
@@ -7,8 +7,12 @@
 #include "perception/common/logging.h"
 
 #include <opencv4/opencv2/calib3d.hpp>
+#include <opencv4/opencv2/imgproc.hpp>
 
+#include <algorithm>
+#include <cctype>
 #include <chrono>
+#include <utility>
 
 namespace perception
 {
@@ -21,48 +25,136 @@ constexpr std::int32_t kDefaultNumberOfChessboardBlocksX{9};
 
 /// @brief Default number of chessboard blocks in y axis
 constexpr std::int32_t kDefaultNumberOfChessboardBlocksY{6};
+
+/// @brief Default calibration cache (outside of chessboard data, which is globbed for calibration images)
+const std::string kDefaultCalibrationCache{"camera_calibration_cache.yml"};
+
+/// @brief Max time Step waits for the first frame of the source
+constexpr std::chrono::seconds kFirstFrameTimeout{1};
+
+/// @brief Time to wait before retrying to capture, once source does not provide frames (e.g. end of video)
+constexpr std::chrono::milliseconds kCaptureRetryPeriod{10};
+
+/// @brief Check whether the source is a live camera (device index or device node), which provides frames at its own
+/// frame rate
+///
+/// @param source [in] Camera Source
+///
+/// @return True, if source is a live camera
+bool IsLiveSource(const std::string& source)
+{
+    const auto is_digit = [](const char character) { return std::isdigit(static_cast<unsigned char>(character)) != 0; };
+    return (source.rfind("/dev/", 0U) == 0U) ||
+           (!source.empty() && std::all_of(source.cbegin(), source.cend(), is_digit));
+}
+
+/// @brief Provide period between captures of the source, i.e. the frame period for video files
+///
+/// @param source [in] Camera Source
+/// @param capture_device [in] Capture Device, which opened the source
+///
+/// @return Capture period (zero, if frames are captured as fast as the source provides them)
+std::chrono::steady_clock::duration GetCapturePeriod(const std::string& source, const cv::VideoCapture& capture_device)
+{
+    const auto frames_per_second = capture_device.get(cv::CAP_PROP_FPS);
+    if (IsLiveSource(source) || !(frames_per_second > 0.0))
+    {
+        return std::chrono::steady_clock::duration::zero();
+    }
+    return std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>{1.0 / frames_per_second});
+}
 }  // namespace
 
+constexpr std::size_t Camera::kFramePoolCapacity;
+
 Camera::Camera(const std::string& source)
     : source_{source},
       capture_device_{source_},
-      calibration_{kDefaultChessboardData, kDefaultNumberOfChessboardBlocksX, kDefaultNumberOfChessboardBlocksY}
+      capture_period_{},
+      camera_message_{},
+      frame_pool_{kFramePoolCapacity},
+      calibration_{kDefaultChessboardData,
+                   kDefaultNumberOfChessboardBlocksX,
+                   kDefaultNumberOfChessboardBlocksY,
+                   kDefaultCalibrationCache},
+      undistortion_map_{},
+      undistortion_interpolation_map_{},
+      undistortion_image_size_{},
+      latest_frame_{nullptr, {}, {}, false},
+      mutex_{},
+      condition_{},
+      capturing_{false},
+      dropped_frames_{0U},
+      duplicate_frames_{0U},
+      capture_thread_{}
 {
     CHECK(capture_device_.isOpened());
 }
 
+Camera::~Camera()
+{
+    StopCapture();
+}
+
 void Camera::Init()
 {
+    // capture thread uses the calibration, re-initialization restarts it
+    StopCapture();
     Calibrate();
+    StartCapture();
 }
 
 void Camera::Step()
 {
-    Image image{};
-    capture_device_ >> image;
+    CHECK(capturing_) << "Camera is not capturing.";
 
-    Image undistorted_image{};
-    cv::undistort(image, undistorted_image, calibration_.GetCameraMatrix(), calibration_.GetDistanceCoefficients());
+    std::unique_lock<std::mutex> lock{mutex_};
+    if (!condition_.wait_for(lock, kFirstFrameTimeout, [this] { return latest_frame_.frame != nullptr; }))
+    {
+        LOG_EVERY_T(WARNING, std::chrono::seconds{5}) << "No frame captured from " << source_ << " source.";
+        return;
+    }
+    if (latest_frame_.delivered)
+    {
+        ++duplicate_frames_;
+        return;
+    }
+    latest_frame_.delivered = true;
+    const auto latest_frame = latest_frame_;
+    lock.unlock();
 
-    camera_message_.time_point = std::chrono::system_clock::now();
+    camera_message_.time_point = latest_frame.time_point;
+    camera_message_.capture_time_point = latest_frame.capture_time_point;
     camera_message_.calibration_params.intrinsic = calibration_.GetCameraMatrix();
     camera_message_.calibration_params.extrinsic = calibration_.GetDistanceCoefficients();
-    camera_message_.image = image;
-    camera_message_.undistorted_image = undistorted_image;
+    camera_message_.image = latest_frame.frame->image;
+    camera_message_.undistorted_image = latest_frame.frame->undistorted_image;
+    camera_message_.frame = latest_frame.frame;
 }
 
 void Camera::Shutdown()
 {
+    StopCapture();
     calibration_.Shutdown();
     capture_device_.release();
 }
 
 void Camera::SetSource(const std::string source)
 {
+    const bool capturing = capturing_;
+    StopCapture();
+
     capture_device_.open(source);
     CHECK(capture_device_.isOpened());
+    source_ = source;
 
     LOG(INFO) << "Reading " << source << " source.";
+
+    if (capturing)
+    {
+        StartCapture();
+    }
 }
 
 const CameraMessage& Camera::GetCameraMessage() const
@@ -70,10 +162,136 @@ const CameraMessage& Camera::GetCameraMessage() const
     return camera_message_;
 }
 
+std::uint64_t Camera::GetNumberOfDroppedFrames() const
+{
+    return dropped_frames_;
+}
+
+std::uint64_t Camera::GetNumberOfDuplicateFrames() const
+{
+    return duplicate_frames_;
+}
+
 void Camera::Calibrate()
 {
     calibration_.Init();
     calibration_.Execute();
+
+    // recompute undistortion maps for new calibration on next capture
+    undistortion_image_size_ = cv::Size{};
+}
+
+void Camera::StartCapture()
+{
+    {
+        // frames of the previous source are not provided anymore
+        std::lock_guard<std::mutex> lock{mutex_};
+        latest_frame_ = CapturedFrame{nullptr, {}, {}, false};
+    }
+    capture_period_ = GetCapturePeriod(source_, capture_device_);
+    capturing_ = true;
+    capture_thread_ = std::thread{&Camera::Capture, this};
+}
+
+void Camera::StopCapture()
+{
+    {
+        // under lock, to not miss the notification while the capture thread is about to wait
+        std::lock_guard<std::mutex> lock{mutex_};
+        capturing_ = false;
+    }
+    condition_.notify_all();
+    if (capture_thread_.joinable())
+    {
+        capture_thread_.join();
+    }
+}
+
+void Camera::WaitForCapture(const std::chrono::steady_clock::time_point& time_point)
+{
+    std::unique_lock<std::mutex> lock{mutex_};
+    condition_.wait_until(lock, time_point, [this] { return !capturing_; });
+}
+
+void Camera::Capture()
+{
+    auto next_capture_time_point = std::chrono::steady_clock::now();
+    while (capturing_)
+    {
+        // pace video files by their frame rate, without catching up on captures which took longer than the period
+        if (capture_period_ > std::chrono::steady_clock::duration::zero())
+        {
+            WaitForCapture(next_capture_time_point);
+            next_capture_time_point =
+                std::max(next_capture_time_point + capture_period_, std::chrono::steady_clock::now());
+        }
+
+        auto frame = frame_pool_.Acquire();
+        if (frame == nullptr)
+        {
+            // frame is only dropped, if the source provides one (e.g. not at the end of a video file)
+            if (capture_device_.grab())
+            {
+                LOG_EVERY_T(WARNING, std::chrono::seconds{5})
+                    << "All " << frame_pool_.GetCapacity() << " camera frames are leased by consumers, dropping frame.";
+                ++dropped_frames_;
+            }
+            else
+            {
+                std::this_thread::sleep_for(kCaptureRetryPeriod);
+            }
+            continue;
+        }
+
+        // capture and undistort into the frame buffers, which are reused as long as the image size does not change
+        capture_device_ >> frame->image;
+        const auto capture_time_point = std::chrono::steady_clock::now();
+        const auto time_point = std::chrono::system_clock::now();
+        if (frame->image.empty())
+        {
+            // keep providing the latest frame, until the source provides new frames
+            std::this_thread::sleep_for(kCaptureRetryPeriod);
+            continue;
+        }
+
+        UpdateUndistortionMaps(frame->image.size());
+        cv::remap(frame->image,
+                  frame->undistorted_image,
+                  undistortion_map_,
+                  undistortion_interpolation_map_,
+                  cv::INTER_LINEAR);
+
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+            if ((latest_frame_.frame != nullptr) && !latest_frame_.delivered)
+            {
+                ++dropped_frames_;
+            }
+            latest_frame_ = CapturedFrame{std::move(frame), time_point, capture_time_point, false};
+        }
+        condition_.notify_all();
+    }
+}
+
+void Camera::UpdateUndistortionMaps(const cv::Size& image_size)
+{
+    if (image_size == undistortion_image_size_)
+    {
+        return;
+    }
+
+    // same maps as cv::undistort computes on every call, in fixed-point representation for faster remapping
+    cv::initUndistortRectifyMap(calibration_.GetCameraMatrix(),
+                                calibration_.GetDistanceCoefficients(),
+                                cv::Mat{},
+                                calibration_.GetCameraMatrix(),
+                                image_size,
+                                CV_16SC2,
+                                undistortion_map_,
+                                undistortion_interpolation_map_);
+    undistortion_image_size_ = image_size;
+
+    LOG(INFO) << "Computed undistortion maps for " << image_size.width << "x" << image_size.height << " images.";
 }
 
 }  // namespace perception
@@ -7,15 +7,28 @@
 
 #include "perception/sensor/camera/calibration.h"
 #include "perception/sensor/camera/datatype/camera.h"
+#include "perception/sensor/camera/frame_pool.h"
 
 #include <opencv4/opencv2/core.hpp>
 #include <opencv4/opencv2/videoio.hpp>
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 
 namespace perception
 {
 /// @brief Camera Sensor Model/Interface
+///
+/// @note Frames are captured (and undistorted) continuously on a capture thread, Step provides the latest captured
+/// frame without waiting for the device (latest-frame semantics, i.e. frames not picked up in time are dropped).
+/// Video files are captured at their frame rate (CAP_PROP_FPS) rather than as fast as they can be decoded.
 class Camera final
 {
   public:
@@ -24,10 +37,14 @@ class Camera final
     /// @param source  [in] Camera Source (Image/Video Path or 0 for Live Camera)
     explicit Camera(const std::string& source);
 
-    /// @brief Initialize Camera
+    /// @brief Destructor (stops capture thread, if still running)
+    ~Camera();
+
+    /// @brief Initialize Camera (calibrates and (re)starts capture thread)
     void Init();
 
-    /// @brief Execute single step (performs capture frame and updated camera message buffer)
+    /// @brief Execute single step (updates camera message buffer with the latest captured frame). Blocks only until
+    /// the first frame of the source is captured.
     void Step();
 
     /// @brief Release resources used for Camera
@@ -39,12 +56,63 @@ class Camera final
     void SetSource(const std::string source);
 
     /// @brief Provide last updated Camera Message based on the captured frame
+    ///
+    /// @note Copies of the message lease the captured frame (no image copy), which is not reused for later captures
+    /// until all copies are released. Consumers must not hold more than (kFramePoolCapacity - 3) frames at a time
+    /// (remaining frames are held by camera message, latest captured frame and the frame being captured).
     const CameraMessage& GetCameraMessage() const;
 
+    /// @brief Provide number of captured frames, which have been replaced by a later frame before Step picked them up
+    /// (or could not be captured, since all frames were leased)
+    std::uint64_t GetNumberOfDroppedFrames() const;
+
+    /// @brief Provide number of Steps, which did not find a new frame (i.e. camera message is not updated)
+    std::uint64_t GetNumberOfDuplicateFrames() const;
+
+    /// @brief Number of preallocated frames, shared by camera and consumers
+    static constexpr std::size_t kFramePoolCapacity{6U};
+
   private:
+    /// @brief Captured frame, to be picked up by Step
+    struct CapturedFrame
+    {
+        /// @brief Frame (nullptr, if no frame has been captured yet)
+        std::shared_ptr<const CameraFrame> frame;
+
+        /// @brief Time Point of capture
+        std::chrono::system_clock::time_point time_point;
+
+        /// @brief Time Point of capture (monotonic)
+        std::chrono::steady_clock::time_point capture_time_point;
+
+        /// @brief Frame has been picked up by Step
+        bool delivered;
+    };
+
+    /// @brief Start capture thread
+    ///
+    /// @note Capture thread must not be running (see StopCapture)
+    void StartCapture();
+
+    /// @brief Stop capture thread (no-op, if not running)
+    void StopCapture();
+
+    /// @brief Wait until the given time point or until the capture thread is stopped
+    ///
+    /// @param time_point [in] Time Point to wait for
+    void WaitForCapture(const std::chrono::steady_clock::time_point& time_point);
+
+    /// @brief Capture thread loop, capturing and undistorting frames into the frame pool
+    void Capture();
+
     /// @brief Calibrates based on the provided calibration data
     void Calibrate();
 
+    /// @brief Update undistortion maps, if calibration or image size changed since the last update
+    ///
+    /// @param image_size [in] Size of the captured image
+    void UpdateUndistortionMaps(const cv::Size& image_size);
+
     /// @brief Camera Source
     /// @note Provide {} (i.e. empty string) to use camera inputs or
     /// provide video path to use video as input
@@ -53,11 +121,48 @@ class Camera final
     /// @brief Capture Device
     cv::VideoCapture capture_device_;
 
+    /// @brief Period between captures of the source (zero for live cameras and sources without frame rate, which are
+    /// captured as fast as they provide frames)
+    std::chrono::steady_clock::duration capture_period_;
+
     /// @brief Camera Message
     CameraMessage camera_message_;
 
+    /// @brief Frames, camera captures into
+    FramePool frame_pool_;
+
     /// @brief Provides self-calibration
     Calibration calibration_;
+
+    /// @brief Undistortion map (fixed-point coordinates, CV_16SC2)
+    cv::Mat undistortion_map_;
+
+    /// @brief Undistortion map (interpolation coefficients, CV_16UC1)
+    cv::Mat undistortion_interpolation_map_;
+
+    /// @brief Image size for which undistortion maps have been computed (empty, if maps need to be recomputed)
+    cv::Size undistortion_image_size_;
+
+    /// @brief Latest captured frame
+    CapturedFrame latest_frame_;
+
+    /// @brief Guards latest_frame_
+    std::mutex mutex_;
+
+    /// @brief Signals captured frames
+    std::condition_variable condition_;
+
+    /// @brief Capture thread is running
+    std::atomic<bool> capturing_;
+
+    /// @brief Number of dropped frames
+    std::atomic<std::uint64_t> dropped_frames_;
+
+    /// @brief Number of duplicate frames
+    std::atomic<std::uint64_t> duplicate_frames_;
+
+    /// @brief Capture thread
+    std::thread capture_thread_;
 };
 }  // namespace perception
 
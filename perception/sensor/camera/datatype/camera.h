@@ -8,6 +8,7 @@
 #include <opencv4/opencv2/core.hpp>
 
 #include <chrono>
+#include <memory>
 
 namespace perception
 {
@@ -38,12 +39,25 @@ struct CalibrationParams
 /// @brief Camera Image type
 using Image = cv::Mat;
 
+/// @brief Camera Frame buffers (owned by camera frame pool, reused for later captures once released by all consumers)
+struct CameraFrame
+{
+    /// @brief distorted image (original camera captured)
+    Image image{};
+
+    /// @brief undistorted image (based on the calibration parameters)
+    Image undistorted_image{};
+};
+
 /// @brief Camera Captured information
 struct CameraMessage
 {
     /// @brief Time Point for captured data
     std::chrono::system_clock::time_point time_point{};
 
+    /// @brief Time Point for captured data (monotonic, for frame age and ordering)
+    std::chrono::steady_clock::time_point capture_time_point{};
+
     /// @brief distorted image (original camera captured)
     Image image{};
 
@@ -52,6 +66,10 @@ struct CameraMessage
 
     /// @brief Calibration parameters (intrinsic, extrinsic)
     CalibrationParams calibration_params{};
+
+    /// @brief Lease on the camera frame, image and undistorted_image are views on its buffers (no copy) and remain
+    /// valid as long as the lease is held
+    std::shared_ptr<const CameraFrame> frame{};
 };
 
 }  // namespace perception
@@ -0,0 +1,50 @@
+///
+/// @file
+/// @copyright Copyright (c) 2023. MIT License
+///
+#include "perception/sensor/camera/frame_pool.h"
+
+#include "perception/common/logging.h"
+
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+
+namespace perception
+{
+FramePool::FramePool(const std::size_t capacity) : frames_{}, next_index_{0U}
+{
+    CHECK(capacity > 0U) << "Received invalid frame pool capacity " << capacity;
+
+    frames_.reserve(capacity);
+    std::generate_n(std::back_inserter(frames_), capacity, [] { return std::make_shared<CameraFrame>(); });
+}
+
+std::shared_ptr<CameraFrame> FramePool::Acquire()
+{
+    for (std::size_t count = 0U; count < frames_.size(); ++count)
+    {
+        const auto index = (next_index_ + count) % frames_.size();
+        if (frames_[index].use_count() == 1)
+        {
+            // synchronize with the last consumer releasing its lease, before the frame is overwritten
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+            next_index_ = (index + 1U) % frames_.size();
+            return frames_[index];
+        }
+    }
+    return nullptr;
+}
+
+std::size_t FramePool::GetCapacity() const
+{
+    return frames_.size();
+}
+
+std::size_t FramePool::GetNumberOfLeasedFrames() const
+{
+    return static_cast<std::size_t>(std::count_if(
+        frames_.cbegin(), frames_.cend(), [](const auto& frame) { return frame.use_count() > 1; }));
+}
+}  // namespace perception
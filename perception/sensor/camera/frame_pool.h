@@ -0,0 +1,49 @@
+///
+/// @file
+/// @copyright Copyright (c) 2023. MIT License
+///
+#ifndef PERCEPTION_SENSOR_CAMERA_FRAME_POOL_H
+#define PERCEPTION_SENSOR_CAMERA_FRAME_POOL_H
+
+#include "perception/sensor/camera/datatype/camera.h"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace perception
+{
+/// @brief Fixed-capacity pool of reference-counted camera frames. The camera writes into a free frame, consumers hold
+/// read-only leases (std::shared_ptr<const CameraFrame>) on it. A frame becomes free again once all leases are
+/// released, hence frame buffers are reused instead of allocated for each capture.
+///
+/// @note Single producer: Acquire must not be called concurrently, leases may be released from any thread.
+class FramePool final
+{
+  public:
+    /// @brief Constructor.
+    ///
+    /// @param capacity [in] Number of frames (i.e. max number of frames concurrently held by camera and consumers)
+    explicit FramePool(const std::size_t capacity);
+
+    /// @brief Acquire free frame for writing (round-robin, buffers keep their previous contents and geometry)
+    ///
+    /// @return Frame, or nullptr if all frames are leased
+    std::shared_ptr<CameraFrame> Acquire();
+
+    /// @brief Provide number of frames
+    std::size_t GetCapacity() const;
+
+    /// @brief Provide number of frames, which are currently leased (i.e. not free)
+    std::size_t GetNumberOfLeasedFrames() const;
+
+  private:
+    /// @brief Frames (pool holds one reference on each frame, frame is free if it is the only one)
+    std::vector<std::shared_ptr<CameraFrame>> frames_;
+
+    /// @brief Index of the frame to be checked first by next Acquire
+    std::size_t next_index_;
+};
+}  // namespace perception
+
+#endif  /// PERCEPTION_SENSOR_CAMERA_FRAME_POOL_H
@@ -0,0 +1,48 @@
+///
+/// @file
+/// @copyright Copyright (c) 2023. MIT License
+///
+#include "perception/sensor/camera/calibration.h"
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+namespace perception
+{
+namespace
+{
+/// @brief Calibration images, selected by glob pattern (9 and 20 images)
+const std::vector<std::string> kCalibrationImages{"data/camera_calibration/calibration?.jpg",
+                                                  "data/camera_calibration/*.jpg"};
+
+void RunCalibrationBenchmarkTest(benchmark::State& state, const bool refine_corners)
+{
+    const auto& calibration_images = kCalibrationImages.at(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        Calibration calibration{calibration_images, 9, 6, ""};
+        calibration.SetCornerRefinement(refine_corners);
+        calibration.Init();
+        calibration.Execute();
+        benchmark::DoNotOptimize(calibration.GetCameraMatrix().data);
+    }
+    state.SetLabel(calibration_images);
+}
+
+void Calibration_Benchmark(benchmark::State& state)
+{
+    RunCalibrationBenchmarkTest(state, false);
+}
+
+void Calibration_CornerRefinement_Benchmark(benchmark::State& state)
+{
+    RunCalibrationBenchmarkTest(state, true);
+}
+
+BENCHMARK(Calibration_Benchmark)->DenseRange(0, 1)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(Calibration_CornerRefinement_Benchmark)->DenseRange(0, 1)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+}  // namespace
+}  // namespace perception
@@ -11,6 +11,11 @@
 #include <opencv4/opencv2/core/base.hpp>
 #include <opencv4/opencv2/imgcodecs.hpp>
 
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+
 namespace perception
 {
 namespace
@@ -19,7 +24,7 @@ class CalibrationTest : public ::testing::Test
 {
   public:
     CalibrationTest()
-        : unit_{"data/camera_calibration", 9, 6},
+        : unit_{"data/camera_calibration", 9, 6, ""},
           test_image_path_{"data/camera_calibration/calibration1.jpg"},
           test_undistorted_image_path_{"data/undistorted_calibration1.jpg"}
     {
@@ -68,5 +73,143 @@ TEST_F(CalibrationTest, GivenDistortedImage_ExpectUndistortedImage)
     const cv::Mat expected = cv::imread(test_undistorted_image_path_, cv::IMREAD_GRAYSCALE);
     ASSERT_EQ(actual.size(), expected.size());
 }
+
+TEST(CalibrationDeterminismTest, GivenRepeatedCalibration_ExpectIdenticalCalibrationMatrix)
+{
+    // Given
+    Calibration first{"data/camera_calibration", 9, 6, ""};
+    Calibration second{"data/camera_calibration", 9, 6, ""};
+
+    // When
+    first.Init();
+    first.Execute();
+    second.Init();
+    second.Execute();
+
+    // Then
+    EXPECT_EQ(cv::norm(first.GetCameraMatrix(), second.GetCameraMatrix()), 0.0);
+    EXPECT_EQ(cv::norm(first.GetDistanceCoefficients(), second.GetDistanceCoefficients()), 0.0);
+}
+
+TEST(CalibrationDeterminismTest, GivenCornerRefinement_ExpectRefinedCalibrationMatrix)
+{
+    // Given
+    Calibration unrefined{"data/camera_calibration", 9, 6, ""};
+    unrefined.Init();
+    unrefined.Execute();
+    Calibration unit{"data/camera_calibration", 9, 6, ""};
+    unit.SetCornerRefinement(true);
+
+    // When
+    unit.Init();
+    unit.Execute();
+
+    // Then
+    ASSERT_FALSE(unit.GetCameraMatrix().empty());
+    EXPECT_GT(cv::norm(unit.GetCameraMatrix(), unrefined.GetCameraMatrix()), 0.0);
+    EXPECT_GT(unit.GetRootMeanSquareError(), 0.0);
+    EXPECT_LE(unit.GetRootMeanSquareError(), unrefined.GetRootMeanSquareError());
+}
+
+TEST(CalibrationCacheTest, GivenCalibrationCache_ExpectCachedCalibrationWithoutRecalibration)
+{
+    // Given
+    const std::string cache_filename{::testing::TempDir() + "calibration_cache.yml"};
+    std::remove(cache_filename.c_str());
+    Calibration calibration{"data/camera_calibration", 9, 6, cache_filename};
+    calibration.Init();
+    calibration.Execute();
+
+    // camera matrix edited in the (valid) cache, i.e. differs from the one calibrated from the images
+    const cv::Mat cached_camera_matrix = calibration.GetCameraMatrix() * 2.0;
+    {
+        const cv::FileStorage written{cache_filename, cv::FileStorage::READ};
+        ASSERT_TRUE(written.isOpened());
+        cv::Size image_size{};
+        written["image_size"] >> image_size;
+        cv::FileStorage cache{cache_filename + ".edited", cv::FileStorage::WRITE};
+        cache << "version" << static_cast<std::int32_t>(written["version"]);
+        cache << "inputs_hash" << static_cast<std::string>(written["inputs_hash"]);
+        cache << "image_size" << image_size;
+        cache << "camera_matrix" << cached_camera_matrix;
+        cache << "distance_coefficients" << calibration.GetDistanceCoefficients();
+        cache << "rotation" << calibration.GetRotationMatrix();
+        cache << "translation" << calibration.GetTranslationMatrix();
+    }
+    ASSERT_EQ(std::rename((cache_filename + ".edited").c_str(), cache_filename.c_str()), 0);
+
+    // When
+    Calibration unit{"data/camera_calibration", 9, 6, cache_filename};
+    unit.Init();
+    unit.Execute();
+
+    // Then
+    EXPECT_EQ(cv::norm(unit.GetCameraMatrix(), cached_camera_matrix), 0.0);
+    EXPECT_EQ(cv::norm(unit.GetDistanceCoefficients(), calibration.GetDistanceCoefficients()), 0.0);
+    EXPECT_EQ(unit.GetRotationMatrix().size(), calibration.GetRotationMatrix().size());
+    EXPECT_EQ(unit.GetTranslationMatrix().size(), calibration.GetTranslationMatrix().size());
+}
+
+TEST(CalibrationCacheTest, GivenOutdatedCalibrationCache_ExpectRecalibration)
+{
+    // Given
+    const std::string cache_filename{::testing::TempDir() + "outdated_calibration_cache.yml"};
+    {
+        cv::FileStorage cache{cache_filename, cv::FileStorage::WRITE};
+        cache << "version" << 1;
+        cache << "inputs_hash" << "0";
+        cache << "camera_matrix" << cv::Mat::eye(3, 3, CV_64F);
+    }
+    Calibration unit{"data/camera_calibration", 9, 6, cache_filename};
+
+    // When
+    unit.Init();
+    unit.Execute();
+
+    // Then
+    ASSERT_FALSE(unit.GetCameraMatrix().empty());
+    EXPECT_GT(cv::norm(unit.GetCameraMatrix(), cv::Mat::eye(3, 3, CV_64F)), 0.0);
+}
+
+TEST(CalibrationCacheTest, GivenMalformedCalibrationCache_ExpectRecalibration)
+{
+    // Given
+    const std::string cache_filename{::testing::TempDir() + "malformed_calibration_cache.yml"};
+    {
+        // e.g. cache truncated by a crash while being written
+        std::ofstream cache{cache_filename};
+        cache << "%YAML:1.0\n---\nversion: 1\ncamera_matrix: !!opencv-matrix\n   rows: 3\n   data: [ 1., 0.";
+    }
+    Calibration unit{"data/camera_calibration", 9, 6, cache_filename};
+
+    // When
+    unit.Init();
+    unit.Execute();
+
+    // Then
+    EXPECT_FALSE(unit.GetCameraMatrix().empty());
+    EXPECT_FALSE(unit.GetDistanceCoefficients().empty());
+}
+
+TEST(CalibrationCacheTest, GivenCalibration_ExpectCacheReplacedWithoutTemporaryFile)
+{
+    // Given
+    const std::string cache_filename{::testing::TempDir() + "replaced_calibration_cache.yml"};
+    {
+        std::ofstream cache{cache_filename};
+        cache << "%YAML:1.0\n---\nversion: 0\n";
+    }
+    Calibration unit{"data/camera_calibration", 9, 6, cache_filename};
+
+    // When
+    unit.Init();
+    unit.Execute();
+
+    // Then
+    const cv::FileStorage cache{cache_filename, cv::FileStorage::READ};
+    ASSERT_TRUE(cache.isOpened());
+    EXPECT_EQ(static_cast<std::int32_t>(cache["version"]), 1);
+    EXPECT_FALSE(std::ifstream{cache_filename + ".tmp"}.good());
+}
 }  // namespace
 }  // namespace perception
@@ -10,7 +10,10 @@
 #include <opencv4/opencv2/imgcodecs.hpp>
 #include <opencv4/opencv2/imgproc.hpp>
 
+#include <chrono>
+#include <cstdint>
 #include <string>
+#include <thread>
 
 namespace perception
 {
@@ -22,6 +25,9 @@ using ::testing::Eq;
 using ::testing::Field;
 using ::testing::Property;
 
+/// @brief Max time to wait for the capture thread
+constexpr std::chrono::seconds kCaptureTimeout{2};
+
 class CameraTest : public ::testing::Test
 {
   public:
@@ -49,17 +55,49 @@ class CameraTest : public ::testing::Test
 
     void TearDown() override { unit_.Shutdown(); }
 
+    void InitAgain() { unit_.Init(); }
+
+    /// @brief Wait (bounded by kCaptureTimeout) until the given condition holds, polling it while the capture thread
+    /// runs
+    template <typename Condition>
+    bool WaitUntil(const Condition& condition) const
+    {
+        const auto deadline = std::chrono::steady_clock::now() + kCaptureTimeout;
+        while (!condition())
+        {
+            if (std::chrono::steady_clock::now() > deadline)
+            {
+                return false;
+            }
+            std::this_thread::yield();
+        }
+        return true;
+    }
+
+    /// @brief Step until the camera message provides a frame different from the current one
+    bool StepUntilNewFrame()
+    {
+        const auto current_frame = GetResults().frame;
+        return WaitUntil([this, &current_frame] {
+            unit_.Step();
+            return GetResults().frame != current_frame;
+        });
+    }
+
     void SetImageSource() { unit_.SetSource(test_image_path_); }
     void SetVideoSource() { unit_.SetSource(test_video_path_); }
     void SetInvalidSource() { unit_.SetSource(test_invalid_path_); }
 
     const Image& GetTestVideoFrame() const { return test_video_frame_; }
+    double GetTestVideoFrameRate() const { return test_capture_.get(cv::CAP_PROP_FPS); }
     const Image& GetTestImage() const { return test_image_; }
     const Image& GetTestImageUndistorted() const { return test_image_undistorted_; }
     const cv::Mat& GetTestIntrinsicParam() const { return test_calibration_.intrinsic; }
     const cv::Mat& GetTestExtrinsicParam() const { return test_calibration_.extrinsic; }
 
     const CameraMessage& GetResults() const { return unit_.GetCameraMessage(); }
+    std::uint64_t GetNumberOfDroppedFrames() const { return unit_.GetNumberOfDroppedFrames(); }
+    std::uint64_t GetNumberOfDuplicateFrames() const { return unit_.GetNumberOfDuplicateFrames(); }
 
   private:
     const std::string test_image_path_;
@@ -114,6 +152,108 @@ TEST_F(CameraTest, GivenTypicalSourceVideo_ExpectValidVideoFrame)
                       AllOf(Property(&Image::empty, false), Field(&Image::size, GetTestVideoFrame().size))));
 }
 
+TEST_F(CameraTest, GivenChangedSourceResolution_ExpectUndistortedImageWithNewResolution)
+{
+    // Given
+    SetImageSource();
+    RunOnce();
+
+    // When
+    SetVideoSource();
+    RunOnce();
+
+    // Then
+    const auto& actual = GetResults();
+    EXPECT_THAT(actual,
+                Field(&CameraMessage::undistorted_image,
+                      AllOf(Property(&Image::empty, false), Field(&Image::size, GetTestVideoFrame().size))));
+}
+
+TEST_F(CameraTest, GivenLeasedCameraMessage_ExpectLeasedFrameNotReused)
+{
+    // Given
+    SetVideoSource();
+    RunOnce();
+    const CameraMessage leased_message = GetResults();
+
+    // When
+    ASSERT_TRUE(StepUntilNewFrame());
+
+    // Then
+    const auto& actual = GetResults();
+    EXPECT_NE(actual.frame, nullptr);
+    EXPECT_NE(actual.frame, leased_message.frame);
+    EXPECT_NE(actual.image.data, leased_message.image.data);
+    EXPECT_GE(actual.capture_time_point, leased_message.capture_time_point);
+}
+
+TEST_F(CameraTest, GivenStepFasterThanCapture_ExpectDuplicateFrame)
+{
+    // Given
+    SetImageSource();
+    RunOnce();
+
+    // When
+    RunOnce();
+
+    // Then
+    EXPECT_GE(GetNumberOfDuplicateFrames(), 1U);
+    EXPECT_FALSE(GetResults().image.empty());
+}
+
+TEST_F(CameraTest, GivenCaptureFasterThanStep_ExpectLatestFrameAndDroppedFrames)
+{
+    // Given
+    SetVideoSource();
+    RunOnce();
+    const auto first_capture_time_point = GetResults().capture_time_point;
+
+    // When
+    ASSERT_TRUE(WaitUntil([this] { return GetNumberOfDroppedFrames() > 0U; }));
+    RunOnce();
+
+    // Then
+    EXPECT_GT(GetNumberOfDroppedFrames(), 0U);
+    EXPECT_GT(GetResults().capture_time_point, first_capture_time_point);
+}
+
+TEST_F(CameraTest, GivenVideoSource_ExpectFramesCapturedAtVideoFrameRate)
+{
+    // Given
+    SetVideoSource();
+    ASSERT_GT(GetTestVideoFrameRate(), 0.0);
+    const std::chrono::duration<double> capture_period{1.0 / GetTestVideoFrameRate()};
+    ASSERT_TRUE(StepUntilNewFrame());
+
+    // When
+    auto capture_time_point = GetResults().capture_time_point;
+    for (std::int32_t frame = 0; frame < 3; ++frame)
+    {
+        ASSERT_TRUE(StepUntilNewFrame());
+        const auto previous_capture_time_point = capture_time_point;
+        capture_time_point = GetResults().capture_time_point;
+
+        // Then
+        // paced by the video frame rate rather than captured as fast as decodable (half a period allows for jitter)
+        const std::chrono::duration<double> gap{capture_time_point - previous_capture_time_point};
+        EXPECT_GE(gap.count(), 0.5 * capture_period.count());
+    }
+}
+
+TEST_F(CameraTest, GivenInitializedCamera_WhenInitAgain_ExpectCapturing)
+{
+    // Given
+    SetVideoSource();
+    RunOnce();
+
+    // When
+    InitAgain();
+    RunOnce();
+
+    // Then
+    EXPECT_FALSE(GetResults().image.empty());
+}
+
 TEST_F(CameraTest, GivenInvalidSource_ExpectException)
 {
     // Then
@@ -0,0 +1,72 @@
+///
+/// @file
+/// @copyright Copyright (c) 2023. MIT License
+///
+#include "perception/sensor/camera/frame_pool.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+namespace perception
+{
+namespace
+{
+TEST(FramePoolTest, Acquire_GivenAllFramesLeased_ExpectNoFrame)
+{
+    // Given
+    FramePool unit{2U};
+    const std::shared_ptr<const CameraFrame> first_lease = unit.Acquire();
+    const std::shared_ptr<const CameraFrame> second_lease = unit.Acquire();
+
+    // When
+    const auto frame = unit.Acquire();
+
+    // Then
+    EXPECT_NE(first_lease, nullptr);
+    EXPECT_NE(second_lease, nullptr);
+    EXPECT_NE(first_lease, second_lease);
+    EXPECT_EQ(frame, nullptr);
+    EXPECT_EQ(unit.GetNumberOfLeasedFrames(), 2U);
+}
+
+TEST(FramePoolTest, Acquire_GivenReleasedLease_ExpectFrameBuffersReused)
+{
+    // Given
+    FramePool unit{2U};
+    const std::shared_ptr<const CameraFrame> lease = unit.Acquire();
+    auto frame = unit.Acquire();
+    frame->image.create(480, 640, CV_8UC3);
+    const auto* const data = frame->image.data;
+    frame.reset();
+
+    // When
+    frame = unit.Acquire();
+    frame->image.create(480, 640, CV_8UC3);
+
+    // Then
+    EXPECT_EQ(frame->image.data, data);
+    EXPECT_EQ(unit.GetNumberOfLeasedFrames(), 2U);
+}
+
+TEST(FramePoolTest, Acquire_GivenLeasedFrame_ExpectLeasedFrameNotReturned)
+{
+    // Given
+    FramePool unit{3U};
+    const std::shared_ptr<const CameraFrame> lease = unit.Acquire();
+
+    // When
+    std::vector<const CameraFrame*> frames{};
+    for (std::size_t count = 0U; count < 4U; ++count)
+    {
+        frames.push_back(unit.Acquire().get());
+    }
+
+    // Then
+    EXPECT_THAT(frames, ::testing::Each(::testing::AllOf(::testing::NotNull(), ::testing::Ne(lease.get()))));
+    EXPECT_EQ(unit.GetNumberOfLeasedFrames(), 1U);
+}
+}  // namespace
+}  // namespace perception
@@ -9,6 +9,7 @@ load("@perception//third_party/logging:logging.bzl", "logging")
 load("@perception//third_party/model:model.bzl", "model")
 load("@perception//third_party/nholthaus:nholthaus.bzl", "nholthaus")
 load("@perception//third_party/nlohmann:nlohmann.bzl", "nlohmann")
+load("@perception//third_party/onnxruntime:onnxruntime.bzl", "onnxruntime")
 load("@perception//third_party/opencv:opencv.bzl", "opencv")
 load("@perception//third_party/openssl:openssl.bzl", "openssl")
 load("@perception//third_party/sysroot:sysroot.bzl", "sysroot")
@@ -31,6 +32,7 @@ def perception_dependencies():
     model()
     nholthaus()
     nlohmann()
+    onnxruntime()
     opencv()
     openssl()
     sysroot()
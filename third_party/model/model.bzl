@@ -1,4 +1,4 @@
-load("@bazel_tools//tools/build_defs/repo:http.bzl", "http_archive")
+load("@bazel_tools//tools/build_defs/repo:http.bzl", "http_archive", "http_file")
 
 def model():
     """ Load ML Models as Dependency """
@@ -8,3 +8,11 @@ def model():
             sha256 = "a53855bdebbcc520c296a0c140bc3bfb0aebebd4a979e970e0242780bb60417d",
             url = "https://github.com/jinay1991/artifactory/releases/download/v1.0/ssd_mobilenet_v2_coco_2018_03_29.tar.gz",
         )
+    if "ssd_mobilenet_v1_onnx" not in native.existing_rules():
+        # TODO: Not pinned yet, the URL follows the moving main branch of onnx/models. Mirror the model in the
+        # artifactory release (like ssd_mobilenet_v2_coco) and add its sha256.
+        http_file(
+            name = "ssd_mobilenet_v1_onnx",
+            downloaded_file_path = "ssd_mobilenet_v1_12.onnx",
+            urls = ["https://github.com/onnx/models/raw/main/validated/vision/object_detection_segmentation/ssd-mobilenetv1/model/ssd_mobilenet_v1_12.onnx"],
+        )
@@ -0,0 +1,21 @@
+load("@bazel_tools//tools/build_defs/repo:http.bzl", "http_archive")
+
+def onnxruntime():
+    """ Load ONNX Runtime (C/C++ API, CPU) as Dependency (prebuilt for x86_64 and aarch64) """
+
+    # TODO: Not pinned yet. Add the sha256 of both release archives (Bazel prints the canonical sha256 of an
+    # unpinned archive on first fetch, verify it against the published release before committing it).
+    if "onnxruntime_linux_x64" not in native.existing_rules():
+        http_archive(
+            name = "onnxruntime_linux_x64",
+            build_file = "//third_party/onnxruntime:onnxruntime.BUILD",
+            url = "https://github.com/microsoft/onnxruntime/releases/download/v1.14.1/onnxruntime-linux-x64-1.14.1.tgz",
+            strip_prefix = "onnxruntime-linux-x64-1.14.1",
+        )
+    if "onnxruntime_linux_aarch64" not in native.existing_rules():
+        http_archive(
+            name = "onnxruntime_linux_aarch64",
+            build_file = "//third_party/onnxruntime:onnxruntime.BUILD",
+            url = "https://github.com/microsoft/onnxruntime/releases/download/v1.14.1/onnxruntime-linux-aarch64-1.14.1.tgz",
+            strip_prefix = "onnxruntime-linux-aarch64-1.14.1",
+        )